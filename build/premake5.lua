@@ -165,6 +165,10 @@ if (downloadRaylib) then
         includedirs { "../src" }
         includedirs { "../include" }
 
+        -- Bake the transparent sprite atlas and its frame table before compiling the game
+        dependson { "atlas_baker" }
+        prebuildcommands { "{CHDIR} \"%{wks.location}\" && \"%{wks.location}/bin/%{cfg.buildcfg}/atlas_baker\"" }
+
         links {"raylib"}
 
         cdialect "C17"
@@ -197,6 +201,41 @@ if (downloadRaylib) then
         filter{}
 		
 
+    project "atlas_baker"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files {"../tools/atlas_baker.c", "../src/sprite_atlas.c", "../include/sprite_atlas.h"}
+        includedirs { "../include" }
+
+        links {"raylib"}
+
+        cdialect "C17"
+
+        includedirs {raylib_dir .. "/src" }
+        platform_defines()
+
+        filter "action:vs*"
+            defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
+            dependson {"raylib"}
+            links {"raylib.lib"}
+            characterset ("Unicode")
+
+        filter "system:windows"
+            defines{"_WIN32"}
+            links {"winmm", "gdi32", "opengl32"}
+            libdirs {"../bin/%{cfg.buildcfg}"}
+
+        filter "system:linux"
+            links {"pthread", "m", "dl", "rt", "X11"}
+
+        filter "system:macosx"
+            links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+
+        filter{}
+
+
     project "raylib"
         kind "StaticLib"
     
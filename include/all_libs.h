@@ -4,6 +4,7 @@
 #include <math.h>
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 
 // pacman_movement.c
@@ -12,5 +13,6 @@
 // main.c
 #include <time.h>
 #include <stddef.h>
+#include <limits.h>
 
 #endif // ALL_LIBS_H
\ No newline at end of file
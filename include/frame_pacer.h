@@ -0,0 +1,68 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include "raylib.h"
+
+#define FRAME_PACER_TARGET_FPS 60       // Frame rate of the capped mode
+#define FRAME_HISTOGRAM_BUCKETS 64      // Histogram buckets, the last one also counts longer frames
+#define FRAME_HISTOGRAM_BUCKET_MS 0.5   // Width of a histogram bucket in milliseconds
+#define FRAME_DEADLINE_TOLERANCE 0.0002 // Seconds a capped frame may end late and still count as on time
+
+// How the end of a frame is timed
+typedef enum {
+    FRAME_PACING_CAPPED,    // FRAME_PACER_TARGET_FPS, sleep then spin to the deadline
+    FRAME_PACING_VSYNC,     // The buffer swap waits for the monitor's refresh
+    FRAME_PACING_UNCAPPED,  // No wait at all
+    FRAME_PACING_MODE_COUNT
+} FramePacingMode;
+
+// Achieved frame times since the last reset
+typedef struct {
+    int frames;
+    double averageMs;
+    double minMs;
+    double maxMs;
+    double p99Ms;                               // 99th percentile, to bucket resolution
+    int missedDeadlines;                        // Capped mode: frames that ended past their deadline
+    int buckets[FRAME_HISTOGRAM_BUCKETS];       // Frames per FRAME_HISTOGRAM_BUCKET_MS of frame time
+} FrameTimeStats;
+
+// Frame Pacer
+// ----------------------------------------------------------------------------------------
+// Takes over frame pacing from raylib (SetTargetFPS(0)) and starts timing frames. Call after InitWindow.
+// Parameters:
+//   mode - Initial pacing mode.
+void InitFramePacer(FramePacingMode mode);
+
+// Switches the pacing mode (and the window's vsync with it) and resets the statistics.
+void SetFramePacingMode(FramePacingMode mode);
+
+// Returns the current pacing mode.
+FramePacingMode GetFramePacingMode(void);
+
+// Returns a short name for a pacing mode ("CAPPED", "VSYNC", "UNCAPPED").
+const char *GetFramePacingModeName(FramePacingMode mode);
+
+// Ends a frame: waits for its deadline in capped mode and records how long the frame took.
+// Call right after EndDrawing. Sleeps in 1ms steps while the remaining time is longer than a
+// sleep is likely to take, then spins for the rest, so the deadline is met closely without
+// burning a core for the whole frame.
+void WaitForNextFrame(void);
+
+// Ends a frame without waiting or recording it, and times the next one from now. For frames
+// that already waited on something else, such as EndDrawing waiting for input.
+void ResyncFramePacer(void);
+
+// Returns the frame time statistics.
+FrameTimeStats GetFrameTimeStats(void);
+
+// Clears the frame time statistics.
+void ResetFrameTimeStats(void);
+
+// Draws the frame time histogram as bars, with a line at the capped mode's frame time.
+// Parameters:
+//   bounds - Area to draw in, in screen coordinates.
+//   color - Color of the bars.
+void DrawFrameTimeHistogram(Rectangle bounds, Color color);
+
+#endif // FRAME_PACER_H
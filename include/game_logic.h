@@ -8,10 +8,14 @@
 #define MAZE_WIDTH 28
 #define MAZE_HEIGHT 31
 #define TILE_SIZE 20
+#define SCREEN_WIDTH 1280   // Virtual screen every state is laid out and drawn in,
+#define SCREEN_HEIGHT 720   // scaled to the window by post_process.c
 #define MAX_GHOSTS 4
 #define PACMAN_DEATH_FRAMES 11
 #define MAX_HIGH_SCORES 5
 #define MAX_NAME_LENGTH 4   // 3 initials + null terminator
+#define GHOST_PATH_LENGTH 16 // Tiles of predicted path kept per ghost for the AI overlay
+#define MOTION_PATH_POINTS 8 // Corners of one tick's movement kept for swept collision
 
 // Tile types
 typedef enum {
@@ -86,10 +90,22 @@ typedef struct {
     int points;         // Points awarded when collected
 } Fruit;
 
+// Where an entity went during the current tick, as a polyline through every tile centre it crossed.
+// Each point carries the fraction of the tick at which it was reached; after the last point it stood still.
+// A tunnel wrap starts a new piece: the entity waits at the end of the old piece and jumps to the start
+// of the new one at that piece's time.
+typedef struct {
+    Vector2 points[MOTION_PATH_POINTS];
+    float times[MOTION_PATH_POINTS];
+    bool jumps[MOTION_PATH_POINTS];     // Point starts a new piece rather than ending a segment
+    int count;
+} MotionPath;
+
 // Pac-Man structure
 typedef struct {
     float x;         // Grid position X
     float y;         // Grid position Y
+    MotionPath path; // Movement during the current tick
     float speed;     // Pixels per frame
     int gridX;       // Grid position X
     int gridY;       // Grid position Y
@@ -98,12 +114,15 @@ typedef struct {
     Direction direction;     // Current direction
     Direction nextDirection; // Queued direction
     Texture2D sprite;
+    float animTimer;         // Timer to control mouth frame switching
+    int currentFrame;        // Current mouth frame (0: closed, 1: half-open, 2: fully open)
 } Player;
 
 // Ghost structure
 typedef struct {
     float x;         // Grid position X
     float y;         // Grid position Y
+    MotionPath path; // Movement during the current tick
     float speed;     // Pixels per frame
     int gridX;       // Grid position X
     int gridY;       // Grid position Y
@@ -123,6 +142,93 @@ typedef struct {
     float stuckTimer;           // Timer to detect if the ghost is stuck
 } Ghost;
 
+// A ghost's latest steering decision, written by update_ghosts for the AI overlay. Diagnostic
+// only: it is not part of the simulation or of GameSnapshot.
+typedef struct {
+    bool valid;                     // A decision has been made since the last full reset
+    int fromX, fromY;               // Tile the decision was made on
+    int targetX, targetY;           // Tile steered towards, or -1 when moving at random (frightened)
+    Direction direction;            // Direction taken
+    int pathLength;                 // Tiles in path; only worked out while aiDebugEnabled is set
+    int pathX[GHOST_PATH_LENGTH];   // Tiles the ghost will cross if its target stays where it is
+    int pathY[GHOST_PATH_LENGTH];
+} GhostDecision;
+
+// Per-tile heatmaps the AI overlay can show
+typedef enum {
+    HEATMAP_NONE,
+    HEATMAP_GHOSTS,     // Tile entries by any ghost
+    HEATMAP_PACMAN,     // Tile entries by Pac-Man
+    HEATMAP_MODE_COUNT
+} HeatmapMode;
+
+// Maze stored as one bitboard row per maze row: bit x of row y is set when tile (x, y) has that type.
+// A tile is set in at most one board; a tile set in none is EMPTY.
+typedef struct {
+    uint32_t walls[MAZE_HEIGHT];
+    uint32_t pellets[MAZE_HEIGHT];
+    uint32_t powerPellets[MAZE_HEIGHT];
+    uint32_t gates[MAZE_HEIGHT];
+} MazeBoard;
+
+_Static_assert(MAZE_WIDTH <= 32, "MazeBoard rows are 32-bit bitboards");
+
+#define TILE_JOURNAL_CAPACITY 256
+
+// One tile mutation recorded by set_tile()
+typedef struct {
+    uint8_t x;          // Tile column
+    uint8_t y;          // Tile row
+    uint8_t oldType;    // TileType before the change
+    uint8_t newType;    // TileType after the change
+} TileChange;
+
+// Tile changes made since the journal was last cleared (once per rendered frame).
+// If overflowed is set the list is incomplete, or the whole maze was reloaded,
+// and consumers must rescan the maze instead of replaying the changes.
+typedef struct {
+    TileChange changes[TILE_JOURNAL_CAPACITY];
+    int count;
+    bool overflowed;
+} TileJournal;
+
+// What a gameplay tick asks the caller to do next (see step_gameplay)
+typedef enum {
+    GAMEPLAY_CONTINUE,      // Keep ticking
+    GAMEPLAY_GAME_OVER,     // Last life lost; the windowed game fades to STATE_GAME_OVER
+    GAMEPLAY_NEXT_LEVEL     // Level finished and reset to READY; the next maze is still to be loaded
+} GameplayEvent;
+
+// Every simulation global, for replays: copied out and put back verbatim
+typedef struct {
+    GameState gameState;
+    GhostMode ghostMode;
+    int ghostModePhase;
+    float modeTimer;
+    float readyTimer;
+    float deathAnimTimer;
+    float blinkTimer;
+    float ghostEatenTimer;
+    int deathAnimFrame;
+    int level;
+    int initialPelletCount;
+    int remainingPelletCount;
+    int pelletsEaten;
+    int powerPelletsEaten;
+    float powerPelletTimer;
+    int eatenGhostCount;
+    int eatenGhostIndex;
+    int totalGhostsEaten;
+    int totalFruitsCollected;
+    float collisionCooldown;
+    int lifeCheckScore;
+    unsigned int simRandomState;
+    Fruit fruit;
+    MazeBoard maze;
+    Player pacman;
+    Ghost ghosts[MAX_GHOSTS];
+} GameSnapshot;
+
 // Global Variables (extern to declare them, defined in game.c)
 extern Texture2D spriteSheet;
 extern GameState gameState;
@@ -135,6 +241,8 @@ extern float ghostEatenTimer;     // Timer for ghost eaten animation
 extern int deathAnimFrame;        // Current frame of death animation
 extern bool isResetting;          // Flag to indicate if game is resetting
 extern int level;                 // Current level
+extern float simDeltaTime;        // Length of the current simulation tick in seconds
+extern int turboSpeed;            // Simulation ticks per rendered frame (1 = normal, 0 = as fast as possible)
 
 extern int initialPelletCount;    // Total number of pellets at the start
 extern int remainingPelletCount;  // Number of pellets remaining
@@ -142,6 +250,18 @@ extern int pelletsEaten;          // Number of pellets eaten in the current leve
 extern int powerPelletsEaten;     // Number of power pellets eaten in the current level
 extern float powerPelletTimer;    // Timer to track power pellet duration
 
+extern int ghostModePhase;        // Chase/scatter phase of the level (0-3)
+extern float collisionCooldown;   // Cooldown to prevent multiple collisions in single frame
+extern int lifeCheckScore;        // Score at the last extra-life check
+extern unsigned int simRandomState; // State of sim_random(); seed it to make a game repeatable
+
+// AI overlay data (not simulation state), cleared on every full reset
+extern bool aiDebugEnabled;       // Work out the ghosts' predicted paths (costly, overlay only)
+extern float ghostModeDuration;   // Length of the current chase/scatter period in seconds
+extern GhostDecision ghostDecisions[MAX_GHOSTS];
+extern int ghostTileVisits[MAZE_HEIGHT][MAZE_WIDTH];
+extern int pacmanTileVisits[MAZE_HEIGHT][MAZE_WIDTH];
+
 extern int eatenGhostCount;       // Number of ghosts eaten in current power pellet
 extern int eatenGhostIndex;       // Index of the ghost being animated
 extern int totalGhostsEaten;      // Total ghosts eanten in the current level
@@ -149,11 +269,14 @@ extern int totalGhostsEaten;      // Total ghosts eanten in the current level
 extern Fruit fruit;               // Bonus fruit
 extern int totalFruitsCollected;  // Total number of fruits collected across levels
 
-extern int maze[MAZE_HEIGHT][MAZE_WIDTH];
+extern MazeBoard maze;
+extern int mazeVersion;            // Bumped every time init_maze() loads a fresh maze
+extern TileJournal tileJournal;     // Tile changes for the current frame
 extern Player pacman;
 extern Ghost ghosts[MAX_GHOSTS];
 
 extern HighScore highscores[MAX_HIGH_SCORES];       // High score array
+extern int highscoresVersion;                       // Bumped whenever the high score table changes
 extern char playerNameInput[4];                     // Buffer for player nmae input (3 chars + null)
 extern int nameInputIndex;                          // Current position in name input
 extern bool nameInputComplete;                      // Flag to indicate name input is done
@@ -206,6 +329,10 @@ void find_pacman_start(int *startX, int *startY);
 //   fullReset - If true, clears pellet counts and maze; if false, preserves them.
 void reset_game_state(bool fullReset, GameState targetState);
 
+// Starts a new game at level 1 with a fresh maze, as choosing START in the menu does once its fade
+// ends. Used by the headless run and the mosaic viewer, which have no fades.
+void start_new_game(void);
+
 // Checks if all pellets and power pellets have been collected, indicating level completion.
 // Returns: true if maze is cleared, false otherwise.
 bool is_maze_cleared(void);
@@ -219,6 +346,31 @@ void init_fruit(void);
 // Updates the fruit's state, handling spawning (at 70 and 140 pellets eaten) and collection.
 void update_fruit(void);
 
+// Returns true for the states that advance the simulation (READY, PLAYING, GHOST_EATEN, DEATH_ANIM
+// and LEVEL_COMPLETE). PAUSED, the menus and the logos do not.
+bool is_simulation_state(GameState state);
+
+// Runs one simulation tick of the gameplay states, including the animations, without sound and
+// fades. The windowed game, the headless run, replay playback and the mosaic all tick through it,
+// so they cannot drift apart.
+// Returns: what the windowed game starts a fade for; acting on it is up to the caller.
+GameplayEvent step_gameplay(void);
+
+// Returns a pseudo-random number in [0, range) from simRandomState. The simulation uses this
+// instead of rand() so its randomness is part of GameSnapshot.
+int sim_random(int range);
+
+// Copies every simulation global into a snapshot (padding zeroed, so snapshots compare with memcmp).
+void capture_game_snapshot(GameSnapshot *snapshot);
+
+// Restores the simulation globals from a snapshot. Textures are kept, and the maze caches are told
+// to rebuild (mazeVersion is bumped).
+void restore_game_snapshot(const GameSnapshot *snapshot);
+
+// Advances the sprite animations (power pellet blink, Pac-Man's mouth, ghost frames and the
+// frightened blink) by one simulation tick. The render functions only read this state.
+void update_animations(void);
+
 // Loads high scores from highscores.txt, using defaults if the file is missing.
 void load_high_scores(void);
 
@@ -230,6 +382,27 @@ void save_high_scores(void);
 //   score - The player's score to check against the high score list.
 void check_and_update_high_scores(int score);
 
+// maze_board.c
+
+// Clears every tile of the maze to EMPTY and marks the journal as needing a full rescan.
+void clear_maze_board(void);
+
+// Returns the type of the tile at (x, y), or EMPTY if it is outside the maze.
+TileType get_tile(int x, int y);
+
+// Sets the tile at (x, y) to the given type and records the change in the tile journal.
+// Positions outside the maze are ignored.
+void set_tile(int x, int y, TileType type);
+
+// Empties the tile journal. Called once per rendered frame after all consumers have read it.
+void clear_tile_journal(void);
+
+// Counts the pellets and power pellets left in the maze (one popcount per row).
+int count_maze_pellets(void);
+
+// Returns true if any pellet or power pellet is left in the maze.
+bool any_maze_pellets(void);
+
 // pacman_movement.c
 
 // Initializes Pac-Man's starting position, speed, score, lives, and direction.
@@ -238,6 +411,14 @@ void check_and_update_high_scores(int score);
 //   startY - Starting Y grid position.
 void init_pacman(int startX, int startY);
 
+// Returns the direction key (arrows / WASD) held down, or DIR_NONE. The caller queues it in
+// pacman.nextDirection before update_pacman; replays and the headless autopilot queue their own.
+Direction read_direction_input(void);
+
+// Queues a random open turn in pacman.nextDirection at every tile centre, preferring not to
+// reverse. The demo autopilot of the headless run and the mosaic viewer.
+void steer_autopilot(void);
+
 // Updates Pac-Man's movement, direction changes, pellet collection, and tunnel teleportation.
 void update_pacman(void);
 
@@ -3,10 +3,21 @@
 
 #include "raylib.h"
 #include "game_logic.h"
+#include "screen_layout.h"
 
 // Initializes GUI-related variables, such as selected menu options.
 void init_gui(void);
 
+// Renders the menu's faded maze background into two cached textures (pellets on and off), replacing
+// any drawn before. Must be called outside of any drawing, after the window is created.
+// Parameters:
+//   screenWidth - Width of the screen in pixels.
+//   screenHeight - Height of the screen in pixels.
+void init_menu_background(int screenWidth, int screenHeight);
+
+// Unloads the cached menu background textures.
+void unload_menu_background(void);
+
 // Handles input for the main menu (STATE_MENU), updating the selected option and triggering state changes.
 // Parameters:
 //   selectedOption - Pointer to the currently selected menu option (0: Start, 1: Highscores, etc.).
@@ -42,54 +53,48 @@ void handle_game_over_input(int *selectedOption);
 // Renders the main menu screen, displaying menu options, Pac-Man, and ghosts.
 // Handles visual feedback for the currently selected option.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text..
 //   selectedOption  - Index of the currently selected menu option (for highlighting).
 //   pacmanSprite    - Texture for the Pac-Man character to display in the menu.
 //   ghostArray      - Pointer to array of Ghost structs to render animated ghosts.
-void render_menu(int screenWidth, int screenHeight, Font font, int selectedOption, Texture2D pacmanSprite, Ghost* ghostArray);
+void render_menu(const ScreenLayout *layout, Font font, int selectedOption, Texture2D pacmanSprite, Ghost* ghostArray);
 
 // Renders the high scores screen (STATE_HIGHSCORES) with the top scores.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_highscores(int screenWidth, int screenHeight, Font font);
+void render_highscores(const ScreenLayout *layout, Font font);
 
 // Renders the about screen (STATE_ABOUT) with game information.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_about(int screenWidth, int screenHeight, Font font);
+void render_about(const ScreenLayout *layout, Font font);
 
 // Renders the settings menu (STATE_SETTINGS) with volume sliders and mute toggle.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
 //   selectedOption - Currently selected settings option.
-void render_settings_menu(int screenWidth, int screenHeight, Font font, int selectedOption);
+void render_settings_menu(const ScreenLayout *layout, Font font, int selectedOption);
 
 // Renders the pause menu (STATE_PAUSED) with options to resume, restart, adjust settings, or quit.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_pause_menu(int screenWidth, int screenHeight, Font font);
+void render_pause_menu(const ScreenLayout *layout, Font font);
 
 // Renders the level complete screen with score breakdown and progress bar.
-void render_level_complete(int screenWidth, int screenHeight, Font font, float animTimer, int currentLevel,
+void render_level_complete(const ScreenLayout *layout, Font font, float animTimer, int currentLevel,
                            int eatenPellets, int eatenPowerPellets, int eatenGhosts,
                            int collectedFruits, int fruitPoints);
 
 // Renders the game over screen (STATE_GAME_OVER), including name input and high scores.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
 //   gameOverFadeAlpha - Alpha value for fade-in/out effects.
-void render_game_over(int screenWidth, int screenHeight, Font font, float gameOverFadeAlpha);
+void render_game_over(const ScreenLayout *layout, Font font, float gameOverFadeAlpha);
 
 #endif // GUI_H
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <stdbool.h>
+
+// Headless Mode
+// ----------------------------------------------------------------------------------------
+// Returns true when the command line asks for headless mode (--headless).
+bool is_headless_run(int argc, char *argv[]);
+
+// Plays a seeded demo game without a window, audio or GPU: Pac-Man is steered by a random
+// autopilot, every tick runs at the nominal 60 Hz step as fast as the CPU allows, and the
+// scene is built as render commands (render_commands.h) and dumped to disk by the software backend.
+//
+// Options:
+//   --ticks N    Simulation ticks to run (default 3600, one minute of play)
+//   --every N    Write a frame every N ticks (default 60)
+//   --out DIR    Output directory (default "frames")
+//   --format F   "png" or "ppm" (default "png")
+//   --seed N     Random seed for the game and the autopilot (default 1)
+//   --backend B  "software" writes frames, "null" only builds the command lists (default "software")
+// Returns: the process exit code.
+int run_headless(int argc, char *argv[]);
+
+#endif // HEADLESS_H
@@ -0,0 +1,28 @@
+#ifndef MAZE_MESH_H
+#define MAZE_MESH_H
+
+#include "raylib.h"
+#include "game_logic.h"
+
+// Maze Wall Mesh
+// ----------------------------------------------------------------------------------------
+// Builds the wall outline triangles of the current maze on the CPU, without uploading them.
+// Returns: a mesh with vertices, texcoords and (16-bit) indices, or an empty mesh if no maze is
+//          loaded. Free the arrays with MemFree unless the mesh is uploaded and unloaded with UnloadMesh.
+Mesh GenMazeWallMesh(void);
+
+// Builds the maze wall outline (straight edges and rounded corners) as one static triangle mesh
+// and uploads it to the GPU, replacing any previous mesh. Called when a new maze is loaded.
+void BuildMazeWallMesh(void);
+
+// Draws the wall mesh in a single draw call.
+// Parameters:
+//   offsetX - X offset for rendering the maze in pixels.
+//   offsetY - Y offset for rendering the maze in pixels.
+//   color - Color of the wall outline.
+void DrawMazeWallMesh(int offsetX, int offsetY, Color color);
+
+// Unloads the wall mesh and its material.
+void UnloadMazeWallMesh(void);
+
+#endif // MAZE_MESH_H
@@ -0,0 +1,25 @@
+#ifndef MOSAIC_H
+#define MOSAIC_H
+
+#include <stdbool.h>
+
+#define MOSAIC_MAX_BOARDS 64    // Games a mosaic can show
+
+// Mosaic Viewer
+// ----------------------------------------------------------------------------------------
+// Returns true when the command line asks for the mosaic viewer (--mosaic N).
+bool is_mosaic_run(int argc, char *argv[]);
+
+// Opens a window showing a grid of independent autopilot games, for watching batch runs. The
+// games take turns in the one set of game globals: each board is a GameSnapshot that is restored,
+// ticked, drawn and captured again every frame. All boards share the wall layer and the sprite
+// atlas, and each is drawn through its own translate/scale transform, so the frame costs a few
+// draw calls however many boards there are. A finished game restarts on its board.
+//
+// Options:
+//   --mosaic N   Boards to show, 1 to MOSAIC_MAX_BOARDS (e.g. 16 or 64)
+//   --seed N     Random seed; board k plays with seed + k (default 1)
+// Returns: the process exit code.
+int run_mosaic(int argc, char *argv[]);
+
+#endif // MOSAIC_H
@@ -0,0 +1,47 @@
+#ifndef POST_PROCESS_H
+#define POST_PROCESS_H
+
+#include "raylib.h"
+#include "game_logic.h"
+
+// Strength of each CRT effect for one screen (0 = off)
+typedef struct {
+    float scanlines;    // Darkening of the 2px band in every 4 rows
+    float vignette;     // Darkening towards the screen corners
+    float glow;         // Blurred bloom added on top of the scene
+    float noise;        // Animated grain
+} PostProcessSettings;
+
+// Post Processing
+// ----------------------------------------------------------------------------------------
+// Creates the virtual screen (SCREEN_WIDTH x SCREEN_HEIGHT) every frame is drawn into, and compiles
+// the CRT shader. If the shader is unavailable (e.g. OpenGL 1.1) post processing stays off.
+void InitPostProcess(void);
+
+// Frees the shader and the virtual screen.
+void UnloadPostProcess(void);
+
+// Turns the whole pipeline on or off (F4), independently of the per-screen settings.
+void TogglePostProcess(void);
+
+// Starts a frame. The scene is drawn into the virtual screen in SCREEN_WIDTH x SCREEN_HEIGHT
+// coordinates, whatever the window size is.
+// Parameters:
+//   state - Screen being drawn, selects the effect settings.
+void BeginPostProcess(GameState state);
+
+// Scales the virtual screen to the window (nearest neighbour, letterboxed) and applies the
+// effects in the same pass. The frame stays open afterwards, so overlays that must not be
+// processed can still be drawn in window coordinates; finish the frame with EndDrawing.
+// Parameters:
+//   screenRect - Where the virtual screen lands in the window (GetVirtualScreenRect, kept until the window is resized).
+void EndPostProcess(Rectangle screenRect);
+
+// Returns where the virtual screen lands in the window: the largest whole-number scale that
+// fits, centered.
+Rectangle GetVirtualScreenRect(void);
+
+// Returns the size screens are drawn at: the virtual screen, or the window when there is none.
+Vector2 GetVirtualScreenSize(void);
+
+#endif // POST_PROCESS_H
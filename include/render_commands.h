@@ -0,0 +1,111 @@
+#ifndef RENDER_COMMANDS_H
+#define RENDER_COMMANDS_H
+
+#include "raylib.h"
+
+#define RENDER_COMMAND_CAPACITY 1024    // Commands per frame; further pushes are dropped and counted
+#define RENDER_TEXT_ARENA_SIZE 4096     // Bytes of text copied per frame
+
+// What the render functions ask for. Nothing is drawn until the list is submitted to a backend.
+typedef enum {
+    RENDER_CMD_CLEAR,           // Fill the whole target
+    RENDER_CMD_SPRITE,          // Texture region (DrawTexturePro parameters)
+    RENDER_CMD_RECT,            // Filled rectangle
+    RENDER_CMD_CIRCLE,          // Filled circle
+    RENDER_CMD_LINE,            // Thick line
+    RENDER_CMD_ARC,             // Thick arc (DrawArc parameters)
+    RENDER_CMD_TEXT,            // Text run
+    RENDER_CMD_MAZE_PELLETS,    // Pellets, power pellets and ghost gate of the current maze
+    RENDER_CMD_MAZE_WALLS,      // Walls of the current maze
+    RENDER_CMD_PALETTE_TIME,    // Time uniform of the palette shader (sprite_palette.h)
+    RENDER_CMD_HUD              // Score, level and lives labels plus the lives and fruit icons
+} RenderCommandType;
+
+typedef struct {
+    RenderCommandType type;
+    Color color;                // Fill color, or tint for sprites
+    union {
+        struct { Texture2D texture; Rectangle source; Rectangle dest; Vector2 origin; float rotation; } sprite;
+        Rectangle rect;
+        struct { Vector2 center; float radius; } circle;
+        struct { Vector2 start; Vector2 end; float thickness; } line;
+        struct { Vector2 center; float radius; float startAngle; float endAngle; int segments; float thickness; } arc;
+        struct { const Font *font; const char *text; Vector2 position; float fontSize; float spacing; } text;  // text lives in the frame arena
+        struct { int offsetX; int offsetY; int version; int pellets; } maze;
+        float time;
+        struct { float livesX; float fruitsX; float y; int lives; int fruits; int score; } hud;
+    };
+} RenderCommand;
+
+// Where a submitted list ends up
+typedef enum {
+    RENDER_BACKEND_RAYLIB,      // The current raylib target; sprites go through the sprite batch
+    RENDER_BACKEND_SOFTWARE,    // The CPU frame of soft_render.h (text is skipped)
+    RENDER_BACKEND_NULL         // Nothing, for measuring the cost of the game code alone
+} RenderBackend;
+
+// Counters of the last submitted list
+typedef struct {
+    int commands;
+    int textBytes;
+    int dropped;                // Pushes that did not fit the frame's capacity
+    bool unchanged;             // Same commands as the previous submission
+} RenderCommandStats;
+
+// Render Commands
+// ----------------------------------------------------------------------------------------
+// Starts a new, empty command list for this frame.
+void BeginRenderCommands(void);
+
+// Appends a full-target clear.
+void PushClearCommand(Color color);
+
+// Appends a sprite, using the same parameters as DrawTexturePro.
+void PushSpriteCommand(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+// Appends a filled rectangle.
+void PushRectCommand(Rectangle rect, Color color);
+
+// Appends a filled circle.
+void PushCircleCommand(Vector2 center, float radius, Color color);
+
+// Appends a thick line.
+void PushLineCommand(Vector2 start, Vector2 end, float thickness, Color color);
+
+// Appends a thick arc, using the same parameters as DrawArc (rendering.h).
+void PushArcCommand(Vector2 center, float radius, float startAngle, float endAngle, int segments, float thickness, Color color);
+
+// Appends a text run. The string is copied, so TextFormat results can be passed directly.
+// Parameters:
+//   font - Font to draw with; must stay valid until the list is submitted.
+void PushTextCommand(const Font *font, const char *text, Vector2 position, float fontSize, float spacing, Color color);
+
+// Appends one of the maze layers (RENDER_CMD_MAZE_PELLETS or RENDER_CMD_MAZE_WALLS). Each backend
+// draws them its own way: the raylib backend blits the cached layers of rendering.c.
+// Parameters:
+//   version, pellets - Maze the layer shows (mazeVersion and count_maze_pellets()), so that the
+//                      command changes whenever the layer does.
+void PushMazeCommand(RenderCommandType type, int offsetX, int offsetY, int version, int pellets);
+
+// Appends a change of the palette time (SetSpritePaletteTime) for the commands after it. Being
+// part of the list, the blink phase is replayed and hashed like everything else.
+void PushPaletteTimeCommand(float time);
+
+// Appends the HUD. The raylib backend blits the cached HUD layer of rendering.c (RefreshHudLayer);
+// the software backend has no glyphs and draws only the icons.
+// Parameters:
+//   livesX - X position of the first life icon in pixels; lives run right.
+//   fruitsX - X position of the first fruit icon in pixels; fruits run right.
+//   y - Y position of the icon row in pixels.
+//   lives, fruits, score - What the HUD shows, so that the command changes whenever the HUD does.
+void PushHudCommand(float livesX, float fruitsX, float y, int lives, int fruits, int score);
+
+// Draws the list with a backend. Consecutive sprites are first sorted by texture (stable), so a run
+// of sprites from a few textures costs one draw call per texture. The list is kept, so it can be
+// submitted again (for example to another backend) until the next BeginRenderCommands.
+void SubmitRenderCommands(RenderBackend backend);
+
+// Returns the counters of the last submitted list.
+RenderCommandStats GetRenderCommandStats(void);
+
+#endif // RENDER_COMMANDS_H
@@ -4,6 +4,37 @@
 #include "raylib.h"
 #include "game_logic.h"
 
+#define MAZE_WALL_COLOR (Color){ 0, 120, 215, 255 }     // Light Blue
+
+// How the static maze walls are drawn each frame (F3 toggles)
+typedef enum {
+    WALL_RENDER_TEXTURE,    // Cached render texture, one textured quad
+    WALL_RENDER_MESH        // Prebuilt triangle mesh, resolution independent
+} WallRenderMode;
+
+extern WallRenderMode wallRenderMode;
+
+// Where the gameplay screen puts the maze and its HUD on a screen of a given size
+typedef struct {
+    int screenWidth;            // Screen the layout is for
+    int screenHeight;
+    int mazeOffsetX;            // Top-left corner of the maze
+    int mazeOffsetY;
+    int mazeWidth;              // Maze size in pixels
+    int mazeHeight;
+    float livesIconsX;          // First life icon, lives run right
+    float fruitIconsX;          // First fruit icon, fruits run right
+    float iconsY;               // Row of the life and fruit icons
+    Vector2 scoreLabel;         // Top-left corners of the HUD text
+    Vector2 scoreValue;
+    Vector2 levelLabel;
+    Vector2 levelValue;
+    Vector2 highScoreLabel;
+    Vector2 highScoreValue;
+    Vector2 livesLabel;
+    Vector2 readyText;          // "READY!" in the box under the ghost pen
+} GameplayLayout;
+
 // Texture Management
 // ----------------------------------------------------------------------------------------
 // Loads ghost textures and assigns them to the ghost array, handling transparency.
@@ -16,6 +47,42 @@ void LoadGhostTextures(Ghost *ghostArray);
 //   ghostArray - Array of Ghost structures whose textures are to be unloaded.
 void UnloadGhostTextures(Ghost *ghostArray);
 
+// Brings the cached maze layers up to date: rebuilds the wall layer and wall mesh when the maze has
+// been reloaded (mazeVersion changed) and patches the pellet layer from the tile journal.
+// Must be called once per frame outside BeginTextureMode, before the maze is drawn.
+void RefreshMazeTextures(void);
+
+// Unloads the cached maze layers.
+void UnloadMazeTextures(void);
+
+// Draws the cached pellet layer (pellets, power pellets and ghost gate) through the palette shader,
+// which blinks the power pellets with the palette time. Backs RENDER_CMD_MAZE_PELLETS.
+// Parameters:
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+void DrawMazePelletLayer(int offsetX, int offsetY);
+
+// Draws the maze walls in the current wall render mode (F3). Backs RENDER_CMD_MAZE_WALLS.
+// Parameters:
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+void DrawMazeWallLayer(int offsetX, int offsetY);
+
+// Brings the HUD layer up to date: redraws the score, level, high score and lives labels and the
+// lives and fruit icons into their own screen-sized texture, but only when one of the values they
+// show or the layout has changed since the last refresh. Must be called once per frame outside
+// BeginTextureMode, before the HUD is drawn.
+// Parameters:
+//   font - Font for the labels.
+//   layout - Positions from compute_gameplay_layout.
+void RefreshHudLayer(const Font *font, const GameplayLayout *layout);
+
+// Unloads the HUD layer.
+void UnloadHudLayer(void);
+
+// Draws the cached HUD layer over the whole screen. Backs RENDER_CMD_HUD.
+void DrawHudLayer(void);
+
 // Utility Functions
 // ----------------------------------------------------------------------------------------
 // Draws an arc for maze wall corners.
@@ -31,6 +98,8 @@ void DrawArc(Vector2 center, float radius, float startAngle, float endAngle, int
 
 // Rendering Functions
 // ----------------------------------------------------------------------------------------
+// These do not draw: they append to the frame's render command list (render_commands.h), which is
+// drawn by SubmitRenderCommands. Call them between BeginRenderCommands and SubmitRenderCommands.
 
 // Renders the maze, including walls, pellets, power pellets, and ghost gate.
 // Parameters:
@@ -50,6 +119,17 @@ void render_pacman(int offsetX, int offsetY);
 //   offsetY - Y offset for rendering the death animation in pixels.
 void render_pacman_death(int offsetX, int offsetY);
 
+// Returns the atlas frame a ghost is drawn with (body, eyes, frightened or score popup).
+// Parameters:
+//   index - Index of the ghost in the ghosts array.
+Rectangle get_ghost_frame(int index);
+
+// Returns the tint a ghost is drawn with: WHITE, or a palette tint (sprite_palette.h) that makes
+// a frightened ghost flash near the end of its frightened time.
+// Parameters:
+//   index - Index of the ghost in the ghosts array.
+Color get_ghost_tint(int index);
+
 // Renders all ghosts with their respective states and animations.
 // Parameters:
 //   offsetX - X offset for rendering ghosts in pixels.
@@ -62,4 +142,43 @@ void render_ghosts(int offsetX, int offsetY);
 //   offsetY - Y offset for rendering the fruit in pixels.
 void render_fruit(int offsetX, int offsetY);
 
+// Renders the HUD (labels, lives and collected-fruit icons) as one RENDER_CMD_HUD. The command carries
+// the values the HUD shows, so the list only changes when they do.
+// Parameters:
+//   layout - Positions from compute_gameplay_layout.
+void render_hud(const GameplayLayout *layout);
+
+// Lays out the gameplay screen: the maze centered, the HUD text above it and the icons along the bottom.
+// Parameters:
+//   screenWidth - Width of the screen in pixels.
+//   screenHeight - Height of the screen in pixels.
+// Returns: the positions, to be kept until the screen size changes.
+GameplayLayout compute_gameplay_layout(int screenWidth, int screenHeight);
+
+// Renders the gameplay screen: the maze, Pac-Man (or his death animation), the ghosts and the HUD.
+// Shared by the window, headless runs and replay videos (whose software backend has no font, so
+// their HUD is just the icons).
+// Parameters:
+//   layout - Positions from compute_gameplay_layout.
+void render_gameplay(const GameplayLayout *layout);
+
+// Renders the pellets and everything moving in the maze for one of several games drawn at once
+// (mosaic.c). Unlike render_maze it does not use the pellet layer, which only holds one game's
+// pellets. Walls are left out: they are the same in every game, so the caller draws them for all
+// boards in one pass from the shared wall layer (DrawMazeWallLayer).
+// Parameters:
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+void render_board(int offsetX, int offsetY);
+
+// Renders the AI debug overlay (F6) on top of the gameplay screen: each ghost's target tile,
+// predicted path and chosen direction, an optional heatmap, and the mode timers. It only reads what
+// update_ghosts recorded in ghostDecisions; paths are recorded while aiDebugEnabled is set.
+// Parameters:
+//   font - Font for the timers; NULL leaves the text out.
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+//   heatmap - Heatmap drawn under the rest, or HEATMAP_NONE.
+void render_ai_overlay(const Font *font, int offsetX, int offsetY, HeatmapMode heatmap);
+
 #endif // RENDERING_H
\ No newline at end of file
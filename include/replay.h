@@ -0,0 +1,69 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "game_logic.h"
+
+#define REPLAY_DIRECTORY "replays"          // Where the windowed game saves recorded sessions (--record)
+#define REPLAY_KEYFRAME_INTERVAL 600        // Ticks between periodic keyframes (10 s at 60 Hz)
+
+// Input of one simulation tick
+typedef struct {
+    float deltaTime;        // simDeltaTime of the tick
+    Direction direction;    // Direction key held during the tick, DIR_NONE if none
+} ReplayTick;
+
+// Full game state at the start of a tick
+typedef struct {
+    int tick;
+    GameSnapshot state;
+} ReplayKeyframe;
+
+// A recorded session: the input of every simulation tick, plus keyframes wherever the game was
+// changed between ticks (new game, level loaded after a fade, pause menu restart) and at least
+// every REPLAY_KEYFRAME_INTERVAL ticks. Playback can start at any keyframe.
+typedef struct {
+    ReplayTick *ticks;
+    int tickCount;
+    ReplayKeyframe *keyframes;
+    int keyframeCount;
+} Replay;
+
+// Recording
+// ----------------------------------------------------------------------------------------
+// Starts recording a new session, dropping any unsaved one.
+void start_replay_recording(void);
+
+// Returns true while a session is being recorded.
+bool is_replay_recording(void);
+
+// Records the start of a simulation tick. Call before the tick runs and before the input is
+// queued in pacman.nextDirection.
+// Parameters:
+//   deltaTime - Length of the tick (simDeltaTime).
+//   direction - Direction key held during the tick (read_direction_input), DIR_NONE if none.
+void record_replay_tick(float deltaTime, Direction direction);
+
+// Records the end of the tick started by record_replay_tick, after update_animations.
+void finish_replay_tick(void);
+
+// Stops recording and saves the session as <directory>/replay_<date>_<time>.rpl.
+// Returns: false if nothing was recorded or the file could not be written.
+bool stop_replay_recording(const char *directory);
+
+// Playback
+// ----------------------------------------------------------------------------------------
+// Loads a replay written by this build of the game.
+// Returns: false if the file is missing, truncated, or from a build with a different GameSnapshot.
+bool load_replay(const char *fileName, Replay *replay);
+
+// Frees a loaded replay.
+void unload_replay(Replay *replay);
+
+// Returns the index of the last keyframe at or before a tick, or -1 if there is none.
+int find_replay_keyframe(const Replay *replay, int tick);
+
+// Replays one tick: restores the keyframe recorded at that tick (if any), queues the recorded
+// input and runs step_gameplay. Ticks must be played in order from a keyframe.
+void play_replay_tick(const Replay *replay, int tick);
+
+#endif // REPLAY_H
@@ -0,0 +1,28 @@
+#ifndef REPLAY_VIDEO_H
+#define REPLAY_VIDEO_H
+
+#include <stdbool.h>
+
+#define REPLAY_VIDEO_FPS 60     // Frame rate of the rendered video
+
+// Replay Video
+// ----------------------------------------------------------------------------------------
+// Returns true when the command line asks for a replay to be rendered (--render-replay FILE).
+bool is_replay_video_run(int argc, char *argv[]);
+
+// Renders a recorded session (replay.h) to video frames without a window, audio or GPU, faster
+// than real time. Frames are taken at REPLAY_VIDEO_FPS on the recorded clock, so the video keeps
+// the pace of the original game (pauses are left out).
+//
+// The replay is split at keyframes into one segment per job. Each segment is rendered by a copy of
+// this executable that starts from the keyframe's snapshot, and the parts are joined in order.
+//
+// Options:
+//   --render-replay FILE  Replay to render
+//   --format F            "y4m" (default), "png" or "ppm"
+//   --out PATH            y4m: output file, "-" for stdout (default); png/ppm: directory (default "frames")
+//   --jobs N              Segments rendered in parallel (default: number of CPU cores)
+// Returns: the process exit code.
+int run_replay_video(int argc, char *argv[]);
+
+#endif // REPLAY_VIDEO_H
@@ -0,0 +1,106 @@
+#ifndef SCREEN_LAYOUT_H
+#define SCREEN_LAYOUT_H
+
+#include "raylib.h"
+#include "rendering.h"
+
+#define LAYOUT_MENU_OPTIONS 5           // Start, Highscores, About, Settings, Exit
+#define LAYOUT_PAUSE_OPTIONS 4          // Resume, Restart, Settings, Quit
+#define LAYOUT_SETTINGS_OPTIONS 3       // BG music volume, SFX volume, mute
+#define LAYOUT_ABOUT_LINES 5            // Title, credits, version, return hint
+
+// Main menu
+typedef struct {
+    float spriteY;                      // Row Pac-Man and the ghosts run along
+    float spriteWrapX;                  // Pac-Man starts over from the left past this x
+    float optionsY;                     // First option; options are centered on centerX, 30px apart
+    Vector2 title;
+    Vector2 hint;
+} MenuLayout;
+
+// High scores screen
+typedef struct {
+    Vector2 title;
+    float rowsY;                        // First score row; rows are centered on centerX, 20px apart
+    Vector2 hint;
+} HighscoresLayout;
+
+// Settings page, shared by the settings screen and the pause menu's settings
+typedef struct {
+    Vector2 title;                      // "SETTINGS"
+    Vector2 pauseTitle;                 // "PAUSE MENU - SETTINGS"
+    Vector2 labels[LAYOUT_SETTINGS_OPTIONS];
+    float sliderX;                      // Sliders and the mute state, left aligned
+    Vector2 pauseHint;
+} SettingsLayout;
+
+// Pause menu
+typedef struct {
+    Vector2 title;
+    Vector2 options[LAYOUT_PAUSE_OPTIONS];
+} PauseLayout;
+
+// Level complete overlay
+typedef struct {
+    Vector2 title;
+    float subtitleY;                    // "Preparing Level N...", centered
+    float panelY;                       // Top of the score breakdown panel
+    float breakdownY;                   // First breakdown row, 20px apart
+    float barY;                         // Progress bar
+} LevelCompleteLayout;
+
+// Game over screen
+typedef struct {
+    Vector2 title;
+    float finalScoreY;                  // Centered rows whose text changes from game to game
+    float messageY;
+    float nameY;
+    float scoreRowsY;                   // First high score row, 20px apart
+    Vector2 enterInitialsLabel;         // While typing the name
+    Vector2 initialsLabel;              // Once the name is entered
+    Vector2 confirmHint;
+    Vector2 highScoresLabel;
+    Rectangle inputScoreBox;            // Border around the high scores while typing
+    Rectangle scoreBox;                 // Border around the high scores afterwards
+    Vector2 returnHint;
+    Vector2 saveError;
+} GameOverLayout;
+
+// Where everything goes on every screen, for the current window size
+typedef struct {
+    int canvasWidth;                    // Size screens are laid out in: the virtual screen, or
+    int canvasHeight;                   // the window itself when there is no virtual screen
+    float centerX;
+    float centerY;
+
+    Rectangle window;                   // The whole window, for overlays drawn after post processing
+    Rectangle virtualScreen;            // Where the canvas lands in the window
+
+    GameplayLayout gameplay;
+    MenuLayout menu;
+    HighscoresLayout highscores;
+    Vector2 about[LAYOUT_ABOUT_LINES];
+    SettingsLayout settings;
+    PauseLayout pause;
+    LevelCompleteLayout levelComplete;
+    GameOverLayout gameOver;
+
+    // Debug overlays (F1), window coordinates
+    Vector2 renderStatsLine;
+    Vector2 frameStatsLine;
+    Rectangle frameHistogram;
+} ScreenLayout;
+
+// Screen Layout
+// ----------------------------------------------------------------------------------------
+// Lays every screen out again if the window size changed since the last call (a resize, or
+// toggling fullscreen with F11), and does nothing otherwise. Call once per frame, outside drawing.
+// Parameters:
+//   font - Font the screens draw with; static text is measured to center it.
+// Returns: true if the layout was recomputed.
+bool UpdateScreenLayout(Font font);
+
+// Returns the current layout. Valid after the first UpdateScreenLayout.
+const ScreenLayout *GetScreenLayout(void);
+
+#endif // SCREEN_LAYOUT_H
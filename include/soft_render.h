@@ -0,0 +1,81 @@
+#ifndef SOFT_RENDER_H
+#define SOFT_RENDER_H
+
+#include "raylib.h"
+#include "game_logic.h"
+
+// CPU renderer: rasterizes into an in-memory RGBA image without a window or a GPU, for frame dumps
+// and screenshot comparisons on headless machines. Scenes reach it as render commands submitted
+// to RENDER_BACKEND_SOFTWARE (render_commands.h). Only the Image API and plain pixel loops are used,
+// so none of this needs InitWindow.
+
+// Software Renderer
+// ----------------------------------------------------------------------------------------
+// Creates the SCREEN_WIDTH x SCREEN_HEIGHT frame and loads the sprite atlas as an image (baking it
+// from the original sheet if the baked atlas is missing).
+// Returns: false if the atlas could not be loaded.
+bool InitSoftRenderer(void);
+
+// Frees the frame, the atlas image and the cached wall triangles.
+void UnloadSoftRenderer(void);
+
+// Returns the frame drawn so far. The image stays owned by the renderer.
+Image GetSoftFrame(void);
+
+// Writes the frame to disk. ".ppm" is written as binary PPM (P6), anything else goes through ExportImage.
+// Parameters:
+//   fileName - Output path; the extension selects the format.
+// Returns: true on success.
+bool ExportSoftFrame(const char *fileName);
+
+// Primitives
+// ----------------------------------------------------------------------------------------
+// Fills the whole frame with a color.
+void SoftClear(Color color);
+
+// Fills a rectangle (no blending).
+void SoftDrawRectangle(int x, int y, int width, int height, Color color);
+
+// Fills a circle (no blending).
+void SoftDrawCircle(int centerX, int centerY, int radius, Color color);
+
+// Fills a triangle with pixel-centre sampling and a top-left fill rule, like the GPU (no blending).
+void SoftDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);
+
+// Blits an atlas frame with nearest-neighbour sampling and premultiplied alpha blending, using the
+// same parameters as DrawTexturePro without rotation.
+// Parameters:
+//   source - Source rectangle in the sprite atlas.
+//   dest - Destination rectangle in the frame.
+//   origin - Placement origin, relative to dest.
+//   tint - Tint color, or a palette tint (sprite_palette.h).
+void SoftDrawSprite(Rectangle source, Rectangle dest, Vector2 origin, Color tint);
+
+// Maze Layers
+// ----------------------------------------------------------------------------------------
+// Draws the pellets, the power pellets (blinking with the palette time) and the ghost gate of
+// the current maze.
+// Parameters:
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+void SoftDrawMazePellets(int offsetX, int offsetY);
+
+// Draws the maze walls from the wall mesh triangles, rebuilt when a maze is loaded.
+// Parameters:
+//   offsetX - X offset of the maze in pixels.
+//   offsetY - Y offset of the maze in pixels.
+void SoftDrawMazeWalls(int offsetX, int offsetY);
+
+// HUD
+// ----------------------------------------------------------------------------------------
+// Draws the lives and collected-fruit icons of the HUD. Its labels are text, which is drawn from a
+// font's GPU texture and so has no CPU counterpart.
+// Parameters:
+//   livesX - X position of the first life icon in pixels; lives run right.
+//   fruitsX - X position of the first fruit icon in pixels; fruits run right.
+//   y - Y position of the icon row in pixels.
+//   lives - Life icons to draw.
+//   fruits - Fruit icons to draw.
+void SoftDrawHudIcons(float livesX, float fruitsX, float y, int lives, int fruits);
+
+#endif // SOFT_RENDER_H
@@ -0,0 +1,39 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "raylib.h"
+
+// The atlas is the original sprite sheet with black keyed out to transparent, premultiplied alpha,
+// and a strip of pre-rotated Pac-Man frames appended below it. tools/atlas_baker.c bakes it at
+// build time together with the frame table in sprite_frames.h.
+#define SPRITE_SHEET_PATH "assets/sprites/pacman_general_sprites.png"
+#define SPRITE_ATLAS_PATH "assets/sprites/pacman_atlas.png"
+
+#define SPRITE_SHEET_WIDTH 228
+#define SPRITE_SHEET_HEIGHT 248
+#define SPRITE_FRAME_SIZE 16
+
+#define PACMAN_FRAME_COUNT 3            // Closed, half-open, fully open
+#define PACMAN_FRAME_STRIDE 18          // Pac-Man frames are 18px apart in the sheet
+
+// Pre-rotated Pac-Man strip: one row per facing, in Direction order (up, down, left, right)
+#define ROTATED_PACMAN_Y SPRITE_SHEET_HEIGHT
+#define ROTATED_PACMAN_ROWS 4
+
+#define SPRITE_ATLAS_WIDTH SPRITE_SHEET_WIDTH
+#define SPRITE_ATLAS_HEIGHT (SPRITE_SHEET_HEIGHT + ROTATED_PACMAN_ROWS * PACMAN_FRAME_STRIDE)
+
+// Sprite Atlas
+// ----------------------------------------------------------------------------------------
+// Builds the atlas image from the original sprite sheet. Used by the baker and as a runtime
+// fallback when the baked atlas is missing.
+// Parameters:
+//   sheet - The original sprite sheet (SPRITE_SHEET_WIDTH x SPRITE_SHEET_HEIGHT).
+// Returns: the atlas image (SPRITE_ATLAS_WIDTH x SPRITE_ATLAS_HEIGHT), or an empty image if the
+//          sheet has unexpected dimensions. The caller owns the image.
+Image BakeSpriteAtlas(Image sheet);
+
+// Loads the baked atlas texture, baking it from the original sheet at runtime if it is missing.
+Texture2D LoadSpriteAtlas(void);
+
+#endif // SPRITE_ATLAS_H
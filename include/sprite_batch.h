@@ -0,0 +1,44 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "raylib.h"
+
+#define SPRITE_BATCH_CAPACITY 256   // Sprites queued before a forced flush
+
+// Per-frame batching counters
+typedef struct {
+    int sprites;        // Sprites drawn through the batch
+    int drawCalls;      // Flushes that submitted geometry
+    int batchBreaks;    // Flushes forced by a texture change or a full queue
+} SpriteBatchStats;
+
+// Sprite Batch
+// ----------------------------------------------------------------------------------------
+// Starts collecting sprites. Queued sprites are only drawn when the batch is flushed or ended,
+// so anything that must appear on top of them has to be drawn after SpriteBatchEnd.
+void SpriteBatchBegin(void);
+
+// Queues one sprite, using the same parameters as DrawTexturePro. Batched sprites are blended as
+// premultiplied alpha, matching the sprite atlas (sprite_atlas.h).
+// Parameters:
+//   texture - Texture (atlas) to sample from. Switching textures within a batch causes a batch break.
+//   source - Source rectangle in the texture.
+//   dest - Destination rectangle on screen.
+//   origin - Rotation/placement origin, relative to dest.
+//   rotation - Rotation in degrees.
+//   tint - Tint color, or a palette tint (sprite_palette.h), drawn through the palette shader.
+void SpriteBatchDraw(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+// Submits every queued sprite as one textured quad list.
+void SpriteBatchFlush(void);
+
+// Flushes and stops collecting sprites.
+void SpriteBatchEnd(void);
+
+// Starts counting a new frame and keeps the finished frame's counters for GetSpriteBatchStats.
+void SpriteBatchNewFrame(void);
+
+// Returns the counters of the last finished frame.
+SpriteBatchStats GetSpriteBatchStats(void);
+
+#endif // SPRITE_BATCH_H
@@ -0,0 +1,85 @@
+// Generated by tools/atlas_baker.c - do not edit.
+// Source rectangles in the baked sprite atlas (assets/sprites/pacman_atlas.png).
+#ifndef SPRITE_FRAMES_H
+#define SPRITE_FRAMES_H
+
+#include "raylib.h"
+
+// Pac-Man mouth frames, pre-rotated to face each way: [Direction][frame]
+static const Rectangle SPRITE_PACMAN[5][3] = {
+    { { 0, 302, 16, 16 }, { 18, 302, 16, 16 }, { 36, 302, 16, 16 } },    // DIR_NONE
+    { { 0, 248, 16, 16 }, { 18, 248, 16, 16 }, { 36, 248, 16, 16 } },    // DIR_UP
+    { { 0, 266, 16, 16 }, { 18, 266, 16, 16 }, { 36, 266, 16, 16 } },    // DIR_DOWN
+    { { 0, 284, 16, 16 }, { 18, 284, 16, 16 }, { 36, 284, 16, 16 } },    // DIR_LEFT
+    { { 0, 302, 16, 16 }, { 18, 302, 16, 16 }, { 36, 302, 16, 16 } },    // DIR_RIGHT
+};
+
+// Pac-Man death animation frames
+static const Rectangle SPRITE_PACMAN_DEATH[11] = {
+    { 36, 0, 16, 16 },
+    { 52, 0, 16, 16 },
+    { 68, 0, 16, 16 },
+    { 84, 0, 16, 16 },
+    { 100, 0, 16, 16 },
+    { 116, 0, 16, 16 },
+    { 132, 0, 16, 16 },
+    { 148, 0, 16, 16 },
+    { 164, 0, 16, 16 },
+    { 180, 0, 16, 16 },
+    { 196, 0, 16, 16 },
+};
+
+// Ghost body frames: [ghost][Direction][frame]
+static const Rectangle SPRITE_GHOST[4][5][2] = {
+    {
+        { { 4, 64, 16, 16 }, { 20, 64, 16, 16 } },    // DIR_NONE
+        { { 68, 64, 16, 16 }, { 84, 64, 16, 16 } },    // DIR_UP
+        { { 100, 64, 16, 16 }, { 116, 64, 16, 16 } },    // DIR_DOWN
+        { { 36, 64, 16, 16 }, { 52, 64, 16, 16 } },    // DIR_LEFT
+        { { 4, 64, 16, 16 }, { 20, 64, 16, 16 } },    // DIR_RIGHT
+    },
+    {
+        { { 4, 80, 16, 16 }, { 20, 80, 16, 16 } },    // DIR_NONE
+        { { 68, 80, 16, 16 }, { 84, 80, 16, 16 } },    // DIR_UP
+        { { 100, 80, 16, 16 }, { 116, 80, 16, 16 } },    // DIR_DOWN
+        { { 36, 80, 16, 16 }, { 52, 80, 16, 16 } },    // DIR_LEFT
+        { { 4, 80, 16, 16 }, { 20, 80, 16, 16 } },    // DIR_RIGHT
+    },
+    {
+        { { 4, 96, 16, 16 }, { 20, 96, 16, 16 } },    // DIR_NONE
+        { { 68, 96, 16, 16 }, { 84, 96, 16, 16 } },    // DIR_UP
+        { { 100, 96, 16, 16 }, { 116, 96, 16, 16 } },    // DIR_DOWN
+        { { 36, 96, 16, 16 }, { 52, 96, 16, 16 } },    // DIR_LEFT
+        { { 4, 96, 16, 16 }, { 20, 96, 16, 16 } },    // DIR_RIGHT
+    },
+    {
+        { { 4, 112, 16, 16 }, { 20, 112, 16, 16 } },    // DIR_NONE
+        { { 68, 112, 16, 16 }, { 84, 112, 16, 16 } },    // DIR_UP
+        { { 100, 112, 16, 16 }, { 116, 112, 16, 16 } },    // DIR_DOWN
+        { { 36, 112, 16, 16 }, { 52, 112, 16, 16 } },    // DIR_LEFT
+        { { 4, 112, 16, 16 }, { 20, 112, 16, 16 } },    // DIR_RIGHT
+    },
+};
+
+// Returning ghost eyes: [Direction][frame]
+static const Rectangle SPRITE_GHOST_EYES[5][2] = {
+    { { 132, 80, 16, 16 }, { 148, 80, 16, 16 } },    // DIR_NONE
+    { { 164, 80, 16, 16 }, { 180, 80, 16, 16 } },    // DIR_UP
+    { { 180, 80, 16, 16 }, { 196, 80, 16, 16 } },    // DIR_DOWN
+    { { 148, 80, 16, 16 }, { 164, 80, 16, 16 } },    // DIR_LEFT
+    { { 132, 80, 16, 16 }, { 148, 80, 16, 16 } },    // DIR_RIGHT
+};
+
+// Frightened ghost: [0] blue, [1] white (blinking)
+static const Rectangle SPRITE_GHOST_FRIGHTENED[2] = { { 132, 64, 16, 16 }, { 164, 64, 16, 16 } };
+
+// Ghost score popups: 200, 400, 800, 1600
+static const Rectangle SPRITE_GHOST_SCORE[4] = { { 4, 128, 16, 16 }, { 20, 128, 16, 16 }, { 36, 128, 16, 16 }, { 52, 128, 16, 16 } };
+
+// Bonus fruit
+static const Rectangle SPRITE_FRUIT = { 35, 48, 16, 16 };
+
+// HUD life icon
+static const Rectangle SPRITE_LIFE_ICON = { 18, 0, 16, 16 };
+
+#endif // SPRITE_FRAMES_H
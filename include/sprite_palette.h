@@ -0,0 +1,55 @@
+#ifndef SPRITE_PALETTE_H
+#define SPRITE_PALETTE_H
+
+#include "raylib.h"
+
+#define POWER_PELLET_COLOR ORANGE       // Power pellets in the pellet layer; SPRITE_PALETTE_POWER_PELLETS blinks this colour
+
+// Colour swaps the palette shader applies to the atlas and the pellet layer. A draw selects one
+// through its tint (GetSpritePaletteTint), so sprites with different palettes still share a batch.
+typedef enum {
+    SPRITE_PALETTE_NONE,            // Colours as they are, multiplied by the tint as usual
+    SPRITE_PALETTE_FRIGHTENED,      // Frightened ghost: blue and peach flash white and red during its last 2 seconds
+    SPRITE_PALETTE_POWER_PELLETS    // Pellet layer: power pellets show for the first half of every second
+} SpritePalette;
+
+// Sprite Palette
+// ----------------------------------------------------------------------------------------
+// Compiles the palette shader. If it is unavailable (e.g. OpenGL 1.1) palette tints draw as
+// plain WHITE, so nothing blinks but nothing disappears either.
+void LoadSpritePalette(void);
+
+// Frees the palette shader.
+void UnloadSpritePalette(void);
+
+// Returns true when the palette shader is loaded.
+bool IsSpritePaletteReady(void);
+
+// Returns the tint that selects a palette. Palette tints have zero alpha, which no visible
+// ordinary tint has, and carry one parameter in their green and blue channels.
+// Parameters:
+//   palette - Palette to draw with.
+//   seconds - SPRITE_PALETTE_FRIGHTENED: the ghost's remaining frightened time (0 to 16s). Unused otherwise.
+Color GetSpritePaletteTint(SpritePalette palette, float seconds);
+
+// Returns true if a tint selects a palette rather than being an ordinary tint.
+bool IsSpritePaletteTint(Color tint);
+
+// Sets the time uniform: seconds into the power pellets' 1 second blink cycle (blinkTimer).
+void SetSpritePaletteTime(float time);
+
+// Starts drawing through the palette shader, uploading the time uniform. Does nothing if the
+// shader is unavailable. Ordinary tints draw exactly as with raylib's default shader.
+void BeginSpritePalette(void);
+
+// Stops drawing through the palette shader.
+void EndSpritePalette(void);
+
+// Applies a tint to one texel the way the palette shader does, for the software renderer.
+// Parameters:
+//   texel - Texel colour (premultiplied alpha for the atlas).
+//   tint - Ordinary tint or palette tint.
+// Returns: the colour to blend, premultiplied like the texel.
+Color ApplySpritePalette(Color texel, Color tint);
+
+#endif // SPRITE_PALETTE_H
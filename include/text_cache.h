@@ -0,0 +1,46 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "raylib.h"
+
+#define TEXT_CACHE_SIZE 128         // Measured strings kept (direct mapped, a collision replaces the entry)
+#define TEXT_CACHE_MAX_LENGTH 64    // Longer strings are measured every time
+#define TEXT_LABEL_KEYS 4           // Integer inputs a label can be keyed by
+
+// Formatted string that is only rebuilt and re-measured when its inputs change
+typedef struct {
+    char text[TEXT_CACHE_MAX_LENGTH];
+    int keys[TEXT_LABEL_KEYS];      // Inputs the text was last formatted from
+    bool formatted;
+    Vector2 size;                   // Extents of text for the font settings below
+    unsigned int fontId;
+    float fontSize;
+    float spacing;
+    bool measured;
+} TextLabel;
+
+// Text Cache
+// ----------------------------------------------------------------------------------------
+// Same as MeasureTextEx, but remembers the result per (font, text, font size, spacing).
+// Parameters:
+//   font - Font the text is drawn with.
+//   text - String to measure. Entries are keyed by contents, so stack buffers are fine.
+//   fontSize - Font size.
+//   spacing - Spacing between characters.
+Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing);
+
+// Forgets every measured string (e.g. after reloading a font).
+void ClearTextCache(void);
+
+// Formats a label, skipping the work when the keys match the last call.
+// Parameters:
+//   label - Label to update; zero-initialize before the first call.
+//   keys - TEXT_LABEL_KEYS integers identifying the inputs, normally the values being formatted.
+//   format - printf-style format string, followed by its arguments.
+// Returns the label's text.
+const char *FormatTextLabel(TextLabel *label, const int keys[TEXT_LABEL_KEYS], const char *format, ...);
+
+// Measures a label, reusing the last result until its text or the font settings change.
+Vector2 MeasureTextLabel(TextLabel *label, Font font, float fontSize, float spacing);
+
+#endif // TEXT_CACHE_H
@@ -6,10 +6,30 @@
 // Check if a tile is walkable (not a wall, or a ghost gate if specified)
 bool IsTileWalkable(int x, int y, bool canPassGate);
 
+// Check if a position sits on the centre of the given tile
+bool IsAtTileCenter(float x, float y, int gridX, int gridY);
+
 // Calculate distance between points
 float CalculateDistance(float x1, float y1, float x2, float y2);
 
 // Check collision between two entities based on their positions and radius
 bool CheckCollision(float x1, float y1, float x2, float y2, float radius);
 
+// Check collision between two entities moving in straight lines over the same tick.
+// Tests the closest approach of the two motions rather than only the end positions,
+// so fast entities moving towards each other cannot pass through one another.
+bool CheckSweptCollision(Vector2 startA, Vector2 endA, Vector2 startB, Vector2 endB, float radius);
+
+// Start a tick's motion path at the given position and fraction of the tick. Part-way through
+// the tick (after a tunnel wrap) this starts a new piece of the path instead, swept separately.
+void BeginMotionPath(MotionPath *path, float x, float y, float time);
+
+// Add the point reached at the given fraction of the tick to a motion path
+void AddMotionPoint(MotionPath *path, float x, float y, float time);
+
+// Check collision between two entities over the paths they followed during the same tick.
+// Sweeps every stretch of time in which both moved in a straight line, so turns taken
+// part-way through the tick neither invent nor hide a hit.
+bool CheckSweptPathCollision(const MotionPath *a, const MotionPath *b, float radius);
+
 #endif // UTILS_H
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "frame_pacer.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    // Declared here rather than including windows.h, whose names clash with raylib's
+    __declspec(dllimport) void __stdcall Sleep(unsigned long msTimeout);
+#else
+    #include <time.h>
+#endif
+
+#define SLEEP_SAMPLE_LIMIT 1000     // Older sleeps fade out of the estimate after this many
+
+static FramePacingMode pacingMode = FRAME_PACING_CAPPED;
+static double frameStart = 0.0;     // When the current frame started (the last wait ended)
+static double deadline = 0.0;       // When the current frame should end, capped mode
+static FrameTimeStats stats = { 0 };
+static double totalMs = 0.0;
+
+// Running mean and variance of how long a 1ms sleep really takes (Welford)
+static double sleepMean = 0.002;
+static double sleepM2 = 0.0;
+static int sleepSamples = 1;
+static double sleepEstimate = 0.002;    // Mean plus one standard deviation
+
+static void sleep_one_millisecond(void) {
+#if defined(_WIN32)
+    Sleep(1);
+#else
+    struct timespec duration = { 0, 1000000L };
+    nanosleep(&duration, NULL);
+#endif
+}
+
+static void record_sleep(double seconds) {
+    if (sleepSamples < SLEEP_SAMPLE_LIMIT) {
+        sleepSamples ++;
+    }
+    double delta = seconds - sleepMean;
+    sleepMean += delta / sleepSamples;
+    sleepM2 += delta * (seconds - sleepMean);
+    if (sleepSamples == SLEEP_SAMPLE_LIMIT) {
+        sleepM2 *= (double)(SLEEP_SAMPLE_LIMIT - 1) / SLEEP_SAMPLE_LIMIT;   // Keep the variance a window, not a history
+    }
+    sleepEstimate = sleepMean + sqrt(sleepM2 / (sleepSamples - 1));
+}
+
+static void record_frame(double seconds) {
+    double ms = seconds * 1000.0;
+    if (stats.frames == 0 || ms < stats.minMs) stats.minMs = ms;
+    if (stats.frames == 0 || ms > stats.maxMs) stats.maxMs = ms;
+    stats.frames ++;
+    totalMs += ms;
+    stats.averageMs = totalMs / stats.frames;
+
+    int bucket = (int)(ms / FRAME_HISTOGRAM_BUCKET_MS);
+    stats.buckets[(bucket < FRAME_HISTOGRAM_BUCKETS) ? bucket : FRAME_HISTOGRAM_BUCKETS - 1] ++;
+}
+
+// Frame Pacer
+// ----------------------------------------------------------------------------------------
+void InitFramePacer(FramePacingMode mode) {
+    SetTargetFPS(0);    // raylib would otherwise wait inside EndDrawing as well
+    SetFramePacingMode(mode);
+}
+
+void SetFramePacingMode(FramePacingMode mode) {
+    pacingMode = mode;
+    if (mode == FRAME_PACING_VSYNC) {
+        SetWindowState(FLAG_VSYNC_HINT);
+    } else {
+        ClearWindowState(FLAG_VSYNC_HINT);
+    }
+    ResetFrameTimeStats();
+    ResyncFramePacer();
+}
+
+FramePacingMode GetFramePacingMode(void) {
+    return pacingMode;
+}
+
+const char *GetFramePacingModeName(FramePacingMode mode) {
+    static const char *names[FRAME_PACING_MODE_COUNT] = { "CAPPED", "VSYNC", "UNCAPPED" };
+    return (mode >= 0 && mode < FRAME_PACING_MODE_COUNT) ? names[mode] : "?";
+}
+
+void WaitForNextFrame(void) {
+    double now = GetTime();
+
+    if (pacingMode == FRAME_PACING_CAPPED) {
+        if (now > deadline + FRAME_DEADLINE_TOLERANCE) {
+            stats.missedDeadlines ++;
+        }
+
+        // Sleep while a sleep will probably not overshoot, then spin the last stretch
+        while (deadline - now > sleepEstimate) {
+            sleep_one_millisecond();
+            double woke = GetTime();
+            record_sleep(woke - now);
+            now = woke;
+        }
+        while (now < deadline) {
+            now = GetTime();
+        }
+    }
+
+    record_frame(now - frameStart);
+    frameStart = now;
+
+    // Deadlines follow a fixed grid so small overshoots do not add up; a frame more than a whole
+    // period late (a hitch) starts a new grid instead of being followed by a burst of short frames
+    deadline += 1.0 / FRAME_PACER_TARGET_FPS;
+    if (now > deadline) {
+        deadline = now + 1.0 / FRAME_PACER_TARGET_FPS;
+    }
+}
+
+void ResyncFramePacer(void) {
+    frameStart = GetTime();
+    deadline = frameStart + 1.0 / FRAME_PACER_TARGET_FPS;
+}
+
+FrameTimeStats GetFrameTimeStats(void) {
+    FrameTimeStats result = stats;
+
+    // 99th percentile at the upper edge of its bucket
+    int wanted = stats.frames - stats.frames / 100;
+    int seen = 0;
+    for (int i = 0; i < FRAME_HISTOGRAM_BUCKETS && stats.frames > 0; i++) {
+        seen += stats.buckets[i];
+        if (seen >= wanted) {
+            result.p99Ms = fmin((i + 1) * FRAME_HISTOGRAM_BUCKET_MS, stats.maxMs);
+            break;
+        }
+    }
+    return result;
+}
+
+void ResetFrameTimeStats(void) {
+    memset(&stats, 0, sizeof(stats));
+    totalMs = 0.0;
+}
+
+void DrawFrameTimeHistogram(Rectangle bounds, Color color) {
+    int highest = 1;
+    for (int i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+        if (stats.buckets[i] > highest) highest = stats.buckets[i];
+    }
+
+    DrawRectangleRec(bounds, Fade(BLACK, 0.6f));
+    float barWidth = bounds.width / FRAME_HISTOGRAM_BUCKETS;
+    for (int i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+        if (stats.buckets[i] == 0) continue;
+        // Square root scale, so the rare slow frames still show next to the common ones
+        float height = bounds.height * sqrtf((float)stats.buckets[i] / highest);
+        DrawRectangleRec((Rectangle){ bounds.x + i * barWidth, bounds.y + bounds.height - height, fmaxf(barWidth - 1.0f, 1.0f), height }, color);
+    }
+
+    float targetX = bounds.x + (float)(1000.0 / FRAME_PACER_TARGET_FPS / FRAME_HISTOGRAM_BUCKET_MS) * barWidth;
+    DrawLineV((Vector2){ targetX, bounds.y }, (Vector2){ targetX, bounds.y + bounds.height }, YELLOW);
+}
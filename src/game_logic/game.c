@@ -13,6 +13,8 @@ float ghostEatenTimer = 0.0f;           // Timer for ghost eaten
 int deathAnimFrame = 0;                 // Current frame of death animation
 bool isResetting = false;               // Flag to indicate if the game is resetting
 int level = 1;                          // Start at level 1
+float simDeltaTime = 0.0f;              // Length of the current simulation tick
+int turboSpeed = 1;                     // Normal speed, one tick per frame
 
 int initialPelletCount = 0;             // Total number of pellets at the start
 int remainingPelletCount = 0;           // Number of pellets remaining
@@ -20,6 +22,17 @@ int pelletsEaten = 0;                   // Number of pellets eaten in the curren
 int powerPelletsEaten = 0;              // Number of power pellets eaten in the current level
 float powerPelletTimer;                 // Timer to track power pellet duration
 
+int ghostModePhase = 0;                 // Chase/scatter phase of the level (0-3)
+float collisionCooldown = 0.0f;         // Cooldown to prevent multiple collisions in single frame
+int lifeCheckScore = 0;                 // Score at the last extra-life check
+unsigned int simRandomState = 1;        // State of sim_random()
+
+bool aiDebugEnabled = false;            // Predicted ghost paths are only worked out for the overlay
+float ghostModeDuration = 0.0f;         // Length of the current chase/scatter period
+GhostDecision ghostDecisions[MAX_GHOSTS];
+int ghostTileVisits[MAZE_HEIGHT][MAZE_WIDTH];
+int pacmanTileVisits[MAZE_HEIGHT][MAZE_WIDTH];
+
 int eatenGhostCount = 0;                // Number of ghosts eaten in current power pellet
 int eatenGhostIndex = -1;               // Index of the ghost being animated
 int totalGhostsEaten;                   // Total ghosts eanten in the current level
@@ -28,6 +41,7 @@ Fruit fruit;                            // Bonus fruit
 int totalFruitsCollected = 0;           // Total number of fruits collected across levels
 
 HighScore highscores[MAX_HIGH_SCORES];  // High scores array
+int highscoresVersion = 0;              // Bumped whenever highscores[] changes, so cached labels refresh
 char playerNameInput[4] = "AAA";        // Default to "AAA"
 int nameInputIndex = 0;
 bool nameInputComplete = false;
@@ -66,7 +80,9 @@ Sound sfx_game_over;        // Game over sound effects
 bool isFrightenedSoundPaused = false;   //Tracks whether the ghost frightened sound is paused during STATE_GHOST_EATEN
 
 // Define game maze and main entities
-int maze[MAZE_HEIGHT][MAZE_WIDTH];
+MazeBoard maze;
+int mazeVersion = 0;                    // Bumped on every init_maze() so cached maze layers know to rebuild
+TileJournal tileJournal;
 Player pacman;
 Ghost ghosts[MAX_GHOSTS];
 
@@ -140,6 +156,7 @@ void load_high_scores(void) {
     } else {
         printf("Warning: Could not open highscores.txt for reading. Using default scores.\n");
     }
+    highscoresVersion ++;
 }
 
 // Save high scores to file
@@ -174,6 +191,7 @@ void check_and_update_high_scores(int score) {
         highscores[insertIndex].score = score;
         strncpy(highscores[insertIndex].name, playerNameInput, MAX_NAME_LENGTH);
         highscores[insertIndex].name[MAX_NAME_LENGTH - 1] = '\0';
+        highscoresVersion ++;
     }
 }
 
@@ -183,37 +201,32 @@ void check_and_update_high_scores(int score) {
 // --------------------------------------------------------------------------------------------------------------------------
 
 void init_maze(void) {
-    initialPelletCount = 0;
-    remainingPelletCount = 0;
+    clear_maze_board();
 
     for (int y = 0; y < MAZE_HEIGHT; y ++) {
         for (int x = 0; x < MAZE_WIDTH; x ++) {
             switch (game_maze[y][x]) {
             case '#':
-                maze[y][x] = WALL;
+                set_tile(x, y, WALL);
                 break;
             case '.':
-                maze[y][x] = PELLET;
-                initialPelletCount ++;
-                remainingPelletCount ++;
+                set_tile(x, y, PELLET);
                 break;
             case 'O':
-                maze[y][x] = POWER_PELLET;
-                initialPelletCount ++;
-                remainingPelletCount ++;
+                set_tile(x, y, POWER_PELLET);
                 break;
             case '|':
-                maze[y][x] = GHOST_GATE;
-                break;
-            case 'P':
-                maze[y][x] = EMPTY;  // Pac-Man's starting position will be set in init_pacman
+                set_tile(x, y, GHOST_GATE);
                 break;
             default:
-                maze[y][x] = EMPTY;
-                break;
+                break;      // EMPTY, including Pac-Man's starting position ('P')
             }
         }
     }
+
+    initialPelletCount = count_maze_pellets();
+    remainingPelletCount = initialPelletCount;
+    mazeVersion ++;
 }
 
 void find_pacman_start(int *startX, int *startY) {
@@ -274,17 +287,15 @@ void reset_game_state(bool fullReset, GameState targetState) {
         strcpy(playerNameInput, "AAA");
         nameInputIndex = 0;
         nameInputComplete = false;
+
+        // A new game starts new heatmaps
+        memset(ghostDecisions, 0, sizeof(ghostDecisions));
+        memset(ghostTileVisits, 0, sizeof(ghostTileVisits));
+        memset(pacmanTileVisits, 0, sizeof(pacmanTileVisits));
     }
 
     // Recount pellets for the new level state
-    remainingPelletCount = 0;
-    for (int y = 0; y < MAZE_HEIGHT; y++) {
-        for (int x = 0; x < MAZE_WIDTH; x++) {
-            if (maze[y][x] == PELLET || maze[y][x] == POWER_PELLET) {
-                remainingPelletCount++;
-            }
-        }
-    }
+    update_pellet_count();
 
     if (IsSoundPlaying(sfx_ghost_frightened)) {
         StopSound(sfx_ghost_frightened);
@@ -300,12 +311,8 @@ void reset_game_state(bool fullReset, GameState targetState) {
 
 // Check if the maze is cleared (no pellets or power pellets remain)
 bool is_maze_cleared(void) {
-    for (int y = 0; y < MAZE_HEIGHT; y ++) {
-        for (int x = 0; x < MAZE_WIDTH; x ++) {
-            if (maze[y][x] == PELLET || maze[y][x] == POWER_PELLET) {
-                return false;    // Found a pellet or power pellet, maze not cleared
-            }
-        }
+    if (any_maze_pellets()) {
+        return false;       // Found a pellet or power pellet, maze not cleared
     }
     remainingPelletCount = 0;
 
@@ -319,11 +326,212 @@ bool is_maze_cleared(void) {
 
 // Update remaining pellet count (called from update_pacman)
 void update_pellet_count(void) {
-    remainingPelletCount = 0;
-    for (int y = 0; y < MAZE_HEIGHT; y ++) {
-        for (int x = 0; x < MAZE_WIDTH; x ++) {
-            if (maze[y][x] == PELLET || maze[y][x] == POWER_PELLET) {
-                remainingPelletCount ++;
+    remainingPelletCount = count_maze_pellets();
+}
+
+void start_new_game(void) {
+    init_maze();
+    level = 1;
+    pacman.score = 0;
+    pacman.lives = 3;
+    totalFruitsCollected = 0;
+    reset_game_state(true, STATE_READY);
+}
+
+// Returns true for the states that advance the simulation; PAUSED and the menus do not
+bool is_simulation_state(GameState state) {
+    return state == STATE_READY || state == STATE_PLAYING || state == STATE_GHOST_EATEN ||
+           state == STATE_DEATH_ANIM || state == STATE_LEVEL_COMPLETE;
+}
+
+// One gameplay tick without sound or fades. The windowed game, headless runs, replays and the
+// mosaic all tick through here; main.c adds its sounds, fades and the pause key around it.
+GameplayEvent step_gameplay(void) {
+    GameplayEvent event = GAMEPLAY_CONTINUE;
+
+    switch (gameState) {
+        case STATE_READY:
+            readyTimer -= simDeltaTime;
+            if (readyTimer <= 0.0f) {
+                gameState = STATE_PLAYING;
+                readyTimer = 0.0f;
+            }
+            break;
+
+        case STATE_PLAYING:
+            update_pacman();
+            update_ghosts();
+            update_fruit();
+            if (powerPelletTimer > 0.0f) {
+                powerPelletTimer -= simDeltaTime;
+                if (powerPelletTimer < 0.0f) {
+                    powerPelletTimer = 0.0f;
+                }
+            }
+            break;
+
+        case STATE_GHOST_EATEN:
+            ghostEatenTimer -= simDeltaTime;
+            if (ghostEatenTimer <= 0.0f) {
+                eatenGhostIndex = -1;
+                gameState = STATE_PLAYING;
+            }
+            break;
+
+        case STATE_DEATH_ANIM: {
+            deathAnimTimer -= simDeltaTime;
+            float frameDuration = 2.0f / PACMAN_DEATH_FRAMES;
+            int newFrame = (int)((2.0f - deathAnimTimer) / frameDuration);
+            deathAnimFrame = (newFrame < PACMAN_DEATH_FRAMES) ? newFrame : (PACMAN_DEATH_FRAMES - 1);
+
+            if (deathAnimTimer <= 0.0f) {
+                pacman.lives--;
+                if (pacman.lives > 0) {
+                    reset_game_state(false, STATE_READY);
+                } else {
+                    event = GAMEPLAY_GAME_OVER;
+                }
+                deathAnimTimer = 2.0f;
+                deathAnimFrame = 0;
+            }
+            break;
+        }
+
+        case STATE_LEVEL_COMPLETE:
+            deathAnimTimer -= simDeltaTime;
+            if (deathAnimTimer <= 0.0f) {
+                deathAnimTimer = 6.0f;
+                reset_game_state(false, STATE_READY);
+                event = GAMEPLAY_NEXT_LEVEL;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (is_simulation_state(gameState)) {
+        update_animations();
+    }
+    return event;
+}
+
+// Linear congruential generator with the classic C library constants. Unlike rand() its state is
+// a game global, so snapshots capture it
+int sim_random(int range) {
+    simRandomState = simRandomState * 1103515245u + 12345u;
+    return (int)((simRandomState >> 16) % (unsigned int)range);
+}
+
+// Copy every simulation global into a snapshot
+void capture_game_snapshot(GameSnapshot *snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));     // Zeroed padding, so snapshots compare with memcmp
+    snapshot->gameState = gameState;
+    snapshot->ghostMode = ghostMode;
+    snapshot->ghostModePhase = ghostModePhase;
+    snapshot->modeTimer = modeTimer;
+    snapshot->readyTimer = readyTimer;
+    snapshot->deathAnimTimer = deathAnimTimer;
+    snapshot->blinkTimer = blinkTimer;
+    snapshot->ghostEatenTimer = ghostEatenTimer;
+    snapshot->deathAnimFrame = deathAnimFrame;
+    snapshot->level = level;
+    snapshot->initialPelletCount = initialPelletCount;
+    snapshot->remainingPelletCount = remainingPelletCount;
+    snapshot->pelletsEaten = pelletsEaten;
+    snapshot->powerPelletsEaten = powerPelletsEaten;
+    snapshot->powerPelletTimer = powerPelletTimer;
+    snapshot->eatenGhostCount = eatenGhostCount;
+    snapshot->eatenGhostIndex = eatenGhostIndex;
+    snapshot->totalGhostsEaten = totalGhostsEaten;
+    snapshot->totalFruitsCollected = totalFruitsCollected;
+    snapshot->collisionCooldown = collisionCooldown;
+    snapshot->lifeCheckScore = lifeCheckScore;
+    snapshot->simRandomState = simRandomState;
+    memcpy(&snapshot->fruit, &fruit, sizeof(fruit));
+    memcpy(&snapshot->maze, &maze, sizeof(maze));
+    memcpy(&snapshot->pacman, &pacman, sizeof(pacman));
+    memcpy(snapshot->ghosts, ghosts, sizeof(ghosts));
+}
+
+// Put a snapshot back, keeping this process's textures
+void restore_game_snapshot(const GameSnapshot *snapshot) {
+    gameState = snapshot->gameState;
+    ghostMode = snapshot->ghostMode;
+    ghostModePhase = snapshot->ghostModePhase;
+    modeTimer = snapshot->modeTimer;
+    readyTimer = snapshot->readyTimer;
+    deathAnimTimer = snapshot->deathAnimTimer;
+    blinkTimer = snapshot->blinkTimer;
+    ghostEatenTimer = snapshot->ghostEatenTimer;
+    deathAnimFrame = snapshot->deathAnimFrame;
+    level = snapshot->level;
+    initialPelletCount = snapshot->initialPelletCount;
+    remainingPelletCount = snapshot->remainingPelletCount;
+    pelletsEaten = snapshot->pelletsEaten;
+    powerPelletsEaten = snapshot->powerPelletsEaten;
+    powerPelletTimer = snapshot->powerPelletTimer;
+    eatenGhostCount = snapshot->eatenGhostCount;
+    eatenGhostIndex = snapshot->eatenGhostIndex;
+    totalGhostsEaten = snapshot->totalGhostsEaten;
+    totalFruitsCollected = snapshot->totalFruitsCollected;
+    collisionCooldown = snapshot->collisionCooldown;
+    lifeCheckScore = snapshot->lifeCheckScore;
+    simRandomState = snapshot->simRandomState;
+
+    Texture2D fruitSprite = fruit.sprite;
+    fruit = snapshot->fruit;
+    fruit.sprite = fruitSprite;
+
+    Texture2D pacmanSprite = pacman.sprite;
+    pacman = snapshot->pacman;
+    pacman.sprite = pacmanSprite;
+
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        Ghost current = ghosts[i];
+        ghosts[i] = snapshot->ghosts[i];
+        ghosts[i].normalSprite[0] = current.normalSprite[0];
+        ghosts[i].normalSprite[1] = current.normalSprite[1];
+        ghosts[i].frightenedSprite = current.frightenedSprite;
+        ghosts[i].eyeballSprite = current.eyeballSprite;
+    }
+
+    // The whole board may have changed, like a fresh init_maze()
+    maze = snapshot->maze;
+    mazeVersion ++;
+    tileJournal.overflowed = true;
+}
+
+// Advance sprite animations
+void update_animations(void) {
+    float deltaTime = simDeltaTime;
+
+    // Power pellets: 0.5s on, 0.5s off
+    blinkTimer += deltaTime;
+    if (blinkTimer >= 1.0f) {
+        blinkTimer = 0.0f;
+    }
+
+    // Pac-Man's mouth: closed, half-open, fully open
+    pacman.animTimer += deltaTime;
+    if (pacman.animTimer >= 0.1f) {
+        pacman.currentFrame = (pacman.currentFrame + 1) % 3;
+        pacman.animTimer = 0.0f;
+    }
+
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        // Normal ghost animation switches frames every 0.2 seconds
+        ghosts[i].animTimer += deltaTime;
+        if (ghosts[i].animTimer >= 0.2f) {
+            ghosts[i].currentFrame = (ghosts[i].currentFrame + 1) % 2;
+            ghosts[i].animTimer = 0.0f;
+        }
+
+        // Frightened blink cycles every 0.4 seconds (0.2s per texture)
+        if (ghosts[i].state == GHOST_FRIGHTENED) {
+            ghosts[i].frightenedBlinkTimer += deltaTime;
+            if (ghosts[i].frightenedBlinkTimer >= 0.4f) {
+                ghosts[i].frightenedBlinkTimer = 0.0f;
             }
         }
     }
@@ -340,7 +548,7 @@ void init_fruit(void) {
 
 // Update fruit state
 void update_fruit(void) {
-    float deltaTime = GetFrameTime();
+    float deltaTime = simDeltaTime;
 
     // Check if fruit should spawn (after 70, 140 pellets eaten)
     if (!fruit.active && (pelletsEaten == 70 || pelletsEaten == 140)) {
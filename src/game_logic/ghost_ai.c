@@ -1,6 +1,7 @@
 #include "game_logic.h"
 #include "utils.h"
 
+
 // Function to choose best direction toward target
 static Direction choose_best_direction(int currentX, int currentY, int targetX, int targetY, Direction currentDir, bool canPassGate) {
     Direction possibleDirs[4] = {DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT};
@@ -94,6 +95,43 @@ static Direction choose_best_direction(int currentX, int currentY, int targetX,
     return bestDir >= 0 ? possibleDirs[bestDir] : DIR_NONE;
 }
 
+// Records a ghost's decision at a tile centre for the AI overlay. The predicted path repeats the
+// decision tile by tile towards the same target, so it is only worked out while the overlay is on.
+static void record_ghost_decision(int i, int fromX, int fromY, int targetX, int targetY, bool canPassGate) {
+    static const int stepX[5] = { 0, 0, 0, -1, 1 };     // Indexed by Direction
+    static const int stepY[5] = { 0, -1, 1, 0, 0 };
+
+    GhostDecision *decision = &ghostDecisions[i];
+    decision->valid = true;
+    decision->fromX = fromX;
+    decision->fromY = fromY;
+    decision->targetX = targetX;
+    decision->targetY = targetY;
+    decision->direction = ghosts[i].direction;
+    decision->pathLength = 0;
+    if (fromX >= 0 && fromX < MAZE_WIDTH && fromY >= 0 && fromY < MAZE_HEIGHT) {
+        ghostTileVisits[fromY][fromX] ++;
+    }
+    if (!aiDebugEnabled || targetX < 0) {
+        return;
+    }
+
+    int x = fromX;
+    int y = fromY;
+    Direction direction = decision->direction;
+    while (direction != DIR_NONE && decision->pathLength < GHOST_PATH_LENGTH) {
+        x += stepX[direction];
+        y += stepY[direction];
+        decision->pathX[decision->pathLength] = x;
+        decision->pathY[decision->pathLength] = y;
+        decision->pathLength ++;
+        if (x == targetX && y == targetY) {
+            break;
+        }
+        direction = choose_best_direction(x, y, targetX, targetY, direction, canPassGate);
+    }
+}
+
 // Initialize Ghosts
 // ----------------------------------------------------------------------------------------
 void init_ghosts(void) {
@@ -135,9 +173,32 @@ void init_ghosts(void) {
         } else {
             ghosts[i].state = GHOST_PENNED;
         }
+        BeginMotionPath(&ghosts[i].path, ghosts[i].x, ghosts[i].y, 0.0f);
     }
 }
 
+// Checks whether Pac-Man and a ghost met at any point during this tick
+static bool ghost_touches_pacman(const Ghost *ghost) {
+    return CheckSweptPathCollision(&pacman.path, &ghost->path, TILE_SIZE / 2.0f);
+}
+
+// Sends a frightened ghost back to the pen, awards points and starts the ghost eaten pause
+static void eat_ghost(int i) {
+    ghosts[i].state = GHOST_RETURNING;
+    eatenGhostCount ++;
+    totalGhostsEaten ++;
+    int points = 200 * (1 << (eatenGhostCount - 1));    // 200, 400, 800, 1600
+    pacman.score += points;
+    PlaySound(sfx_eat_ghost);
+    // Debug print for the added score
+    printf("Ghost %d eaten! Added %d points. Total score: %d (eatenGhostCount: %d)\n", 
+           i, points, pacman.score, eatenGhostCount);
+    eatenGhostIndex = i;
+    gameState = STATE_GHOST_EATEN;
+    ghostEatenTimer = 1.0f;     // 1 sec pause
+    collisionCooldown = 0.5f;   // Preven immediate re-collision
+}
+
 // Update Ghost Mode (Chase/Scatter switching)
 // ----------------------------------------------------------------------------------------
 void update_ghost_mode(void) {
@@ -154,7 +215,6 @@ void update_ghost_mode(void) {
 
     static float chaseTimes[4];
     static float scatterTimes[4];
-    static int phase = 0;   // Current phase (0-3)
 
     // Set durations for all phases
     for (int i = 0; i < 4; i ++) {
@@ -162,14 +222,363 @@ void update_ghost_mode(void) {
         scatterTimes[i] = (i == 3) ? 0.0f : scatterDuration;    // No scatter in last phase
     }
 
-    modeTimer += GetFrameTime();
+    modeTimer += simDeltaTime;
 
-    float currentDuration = (ghostMode == MODE_CHASE) ? chaseTimes[phase] : scatterTimes[phase];
+    float currentDuration = (ghostMode == MODE_CHASE) ? chaseTimes[ghostModePhase] : scatterTimes[ghostModePhase];
+    ghostModeDuration = currentDuration;
     if (modeTimer >= currentDuration) {
         modeTimer = 0.0f;
         ghostMode = (ghostMode == MODE_CHASE) ? MODE_SCATTER : MODE_CHASE;
         if (ghostMode == MODE_CHASE) {
-            phase = (phase + 1) % 4;    // Moves to next phase
+            ghostModePhase = (ghostModePhase + 1) % 4;    // Moves to next phase
+        }
+    }
+}
+
+// Moves a ghost towards the centre of its target tile, stopping exactly on the centre, and never further than
+// the distance it was given. A ghost that is off its lane or already past the centre (released from the pen
+// between tiles, or after a direction reset) first closes the gap to the lane, then moves along its axis.
+// Every corner is added to the ghost's motion path, timed against the distance it covers this whole tick.
+// Returns whatever part of the distance was left over once the centre was reached.
+static float advance_ghost(Ghost *ghost, float distance, float tickDistance) {
+    float targetX = ghost->gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+    float targetY = ghost->gridY * TILE_SIZE + TILE_SIZE / 2.0f;
+    bool vertical;
+    switch (ghost->direction) {
+        case DIR_UP:
+        case DIR_DOWN:  vertical = true; break;
+        case DIR_LEFT:
+        case DIR_RIGHT: vertical = false; break;
+        default:        return 0.0f;
+    }
+
+    float *along = vertical ? &ghost->y : &ghost->x;    // Coordinate along the direction of travel
+    float *across = vertical ? &ghost->x : &ghost->y;
+    float toAlong = (vertical ? targetY : targetX) - *along;
+    float toAcross = (vertical ? targetX : targetY) - *across;
+
+    float sideways = fminf(distance, fabsf(toAcross));
+    if (sideways > 0.0f) {
+        *across += copysignf(sideways, toAcross);
+        distance -= sideways;
+        AddMotionPoint(&ghost->path, ghost->x, ghost->y, 1.0f - distance / tickDistance);
+    }
+
+    float forward = fminf(distance, fabsf(toAlong));
+    *along += copysignf(forward, toAlong);
+    distance -= forward;
+
+    // Land exactly on the centre once it is reached and carry the rest over
+    if (sideways == fabsf(toAcross) && forward == fabsf(toAlong)) {
+        ghost->x = targetX;
+        ghost->y = targetY;
+    }
+    AddMotionPoint(&ghost->path, ghost->x, ghost->y, 1.0f - distance / tickDistance);
+    return distance;
+}
+
+// Picks the next tile for a returning ghost heading back to the pen, forcing a random way out if it is stuck.
+static void steer_returning_ghost(int i, float deltaTime) {
+    int penX = 14;
+    int penY = 11;
+
+    // Choose direction to return to pen
+    ghosts[i].direction = choose_best_direction(ghosts[i].gridX, ghosts[i].gridY, penX, penY, ghosts[i].direction, true);
+
+    // Update stuck timer
+    if (ghosts[i].direction == DIR_NONE) {
+        ghosts[i].stuckTimer += deltaTime;
+    } else {
+        ghosts[i].stuckTimer = 0.0f; // Reset timer if moving
+    }
+
+    // If stuck for too long, force a random valid direction
+    if (ghosts[i].stuckTimer > 1.0f) { // Stuck for 1 second
+        Direction possibleDirs[4] = {DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT};
+        int validDirs[4] = {0};
+        int validCount = 0;
+
+        for (int d = 0; d < 4; d++) {
+            int newGridX = ghosts[i].gridX;
+            int newGridY = ghosts[i].gridY;
+            switch (possibleDirs[d]) {
+                case DIR_UP:
+                    newGridY--;
+                    break;
+                case DIR_DOWN:
+                    newGridY++;
+                    break;
+                case DIR_LEFT:
+                    newGridX--;
+                    break;
+                case DIR_RIGHT:
+                    newGridX++;
+                    break;
+                default:
+                    break;
+            }
+
+            if (IsTileWalkable(newGridX, newGridY, true)) {
+                validDirs[validCount] = d;
+                validCount++;
+            }
+        }
+
+        if (validCount > 0) {
+            ghosts[i].direction = possibleDirs[validDirs[sim_random(validCount)]];
+            ghosts[i].stuckTimer = 0.0f; // Reset stuck timer
+            // Debug: Log when forcing a new direction
+            printf("Ghost %d was stuck, forcing new direction: %d\n", i, ghosts[i].direction);
+        }
+    }
+    record_ghost_decision(i, ghosts[i].gridX, ghosts[i].gridY, penX, penY, true);
+
+    // Update grid position based on direction, but only if the next tile is walkable
+    int newGridX = ghosts[i].gridX;
+    int newGridY = ghosts[i].gridY;
+    switch (ghosts[i].direction) {
+        case DIR_UP:
+            newGridY--;
+            break;
+        case DIR_DOWN:
+            newGridY++;
+            break;
+        case DIR_LEFT:
+            newGridX--;
+            break;
+        case DIR_RIGHT:
+            newGridX++;
+            break;
+        default:
+            break;
+    }
+
+    if (IsTileWalkable(newGridX, newGridY, true)) {
+        ghosts[i].gridX = newGridX;
+        ghosts[i].gridY = newGridY;
+    } else {
+        ghosts[i].direction = DIR_NONE;
+    }
+}
+
+// Guides a ghost that is leaving the pen to the exit point (row 11, column 14) and out through the gate.
+static void steer_ghost_out_of_pen(int i) {
+    int exitX = 14;
+    int exitY = 11;
+    int fromX = ghosts[i].gridX;
+    int fromY = ghosts[i].gridY;
+    if (ghosts[i].gridY > 11) {
+        ghosts[i].direction = DIR_UP;
+        ghosts[i].gridY--;
+    } else if (ghosts[i].gridX < exitX) {
+        ghosts[i].direction = DIR_RIGHT;
+        ghosts[i].gridX++;
+    } else if (ghosts[i].gridX > exitX) {
+        ghosts[i].direction = DIR_LEFT;
+        ghosts[i].gridX--;
+    } else {
+        ghosts[i].direction = DIR_UP;
+        ghosts[i].gridY--;
+    }
+    record_ghost_decision(i, fromX, fromY, exitX, exitY, true);
+}
+
+// Chooses a ghost's next tile at a tile centre: random when frightened, otherwise towards its chase/scatter target.
+static void choose_ghost_direction(int i) {
+    // Determine target
+    int targetX, targetY;
+    if (ghosts[i].state == GHOST_FRIGHTENED) {
+        // Random movement: Choose a random valid direction
+        Direction possibleDirs[4] = {DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT};
+        int validDirs[4] = {0};
+        int validCount = 0;
+
+        for (int d = 0; d < 4; d++) {
+            int newGridX = ghosts[i].gridX;
+            int newGridY = ghosts[i].gridY;
+            switch (possibleDirs[d]) {
+                case DIR_UP:
+                    newGridY--;
+                    break;
+                case DIR_DOWN:
+                    newGridY++;
+                    break;
+                case DIR_LEFT:
+                    newGridX--;
+                    break;
+                case DIR_RIGHT:
+                    newGridX++;
+                    break;
+                default:
+                    break;
+            }
+
+            // Use utility function to check if the tile is walkable
+            if (IsTileWalkable(newGridX, newGridY, false)) {
+                // Avoid moving back in the opposite direction (prevents jittering)
+                Direction oppositeDir = DIR_NONE;
+                switch (ghosts[i].direction) {
+                    case DIR_UP:    oppositeDir = DIR_DOWN; break;
+                    case DIR_DOWN:  oppositeDir = DIR_UP; break;
+                    case DIR_LEFT:  oppositeDir = DIR_RIGHT; break;
+                    case DIR_RIGHT: oppositeDir = DIR_LEFT; break;
+                    default: break;
+                }
+                if (possibleDirs[d] != oppositeDir || validCount == 0) {
+                    validDirs[validCount] = d;
+                    validCount++;
+                }
+            }
+        }
+
+        if (validCount > 0) {
+            ghosts[i].direction = possibleDirs[validDirs[sim_random(validCount)]];
+        } else {
+            ghosts[i].direction = DIR_NONE;
+        }
+        record_ghost_decision(i, ghosts[i].gridX, ghosts[i].gridY, -1, -1, false);
+
+    } else {
+
+        // Normal behavior (Chase or Scatter)
+        bool isBlinky = (i == 0);       // Blinky is ghost 0
+        float pelletRatio = (float)remainingPelletCount / initialPelletCount;
+
+        if (isBlinky && (level >= 3 || pelletRatio < 0.2f)) {
+            targetX = pacman.gridX;
+            targetY = pacman.gridY;
+        } else if (ghostMode == MODE_SCATTER) {
+            targetX = ghosts[i].scatterTargetX;
+            targetY = ghosts[i].scatterTargetY;
+        } else {    // MODE_CHASE
+            switch (i) {
+                case 0:     // Blinky: Direct chase
+                    targetX = pacman.gridX;
+                    targetY = pacman.gridY;
+                    break;
+
+                case 1:     // Pinky: Ambush (4 tiles ahead of Pac-Man)
+                    targetX = pacman.gridX;
+                    targetY = pacman.gridY;
+                    switch (pacman.direction) {
+                        case DIR_UP:
+                            targetY -= 4;
+                            break;
+                        case DIR_DOWN:
+                            targetY += 4;
+                            break;
+                        case DIR_LEFT:
+                            targetX -= 4;
+                            break;
+                        case DIR_RIGHT:
+                            targetX += 4;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+
+                case 2:     // Inky: Complex targeting
+                {
+                    // Target is 2 tiles ahead of Pac-Man
+                    int intermediateX = pacman.gridX;
+                    int intermediateY = pacman.gridY;
+                    switch (pacman.direction) {
+                        case DIR_UP:
+                            intermediateY -= 2;
+                            break;
+                        case DIR_DOWN:
+                            intermediateY += 2;
+                            break;
+                        case DIR_LEFT:
+                            intermediateX -= 2;
+                            break;
+                        case DIR_RIGHT:
+                            intermediateX += 2;
+                            break;
+                        default:
+                            break;
+                    }
+                    // Vector from Blinky to intermediate point
+                    int vecX = intermediateX - ghosts[0].gridX;
+                    int vecY = intermediateY - ghosts[0].gridY;
+                    // Target is intermediate point + vector
+                    targetX = intermediateX + vecX;
+                    targetY = intermediateY + vecY;
+                    break;
+                }
+
+                case 3:     // Clyde: Chase or scatter based on distance
+                {
+                    float dist = CalculateDistance(ghosts[i].gridX, ghosts[i].gridY, pacman.gridX, pacman.gridY);
+                    if (dist > 8) {
+                        // Chase Pac-Man
+                        targetX = pacman.gridX;
+                        targetY = pacman.gridY;
+                    } else {
+                        // Scatter to bottom-left
+                        targetX = ghosts[i].scatterTargetX;
+                        targetY = ghosts[i].scatterTargetY;
+                    }
+                    break;
+                }
+
+                default:
+                    targetX = pacman.gridX;
+                    targetY = pacman.gridY;
+                    break;
+            }
+        }
+
+        // Ensure target is within bounds
+        targetX = (targetX < 0) ? 0 : (targetX >= MAZE_WIDTH ? MAZE_WIDTH - 1 : targetX);
+        targetY = (targetY < 0) ? 0 : (targetY >= MAZE_HEIGHT ? MAZE_HEIGHT - 1 : targetY);
+
+        // Choose the best direction toward the target
+        ghosts[i].direction = choose_best_direction(ghosts[i].gridX, ghosts[i].gridY, targetX, targetY, ghosts[i].direction, false);
+        record_ghost_decision(i, ghosts[i].gridX, ghosts[i].gridY, targetX, targetY, false);
+    }
+
+    // Update grid position based on direction, but only if the next tile is walkable
+    int newGridX = ghosts[i].gridX;
+    int newGridY = ghosts[i].gridY;
+    switch (ghosts[i].direction) {
+        case DIR_UP:
+            newGridY--;
+            break;
+        case DIR_DOWN:
+            newGridY++;
+            break;
+        case DIR_LEFT:
+            newGridX--;
+            break;
+        case DIR_RIGHT:
+            newGridX++;
+            break;
+        default:
+            break;
+    }
+
+    if (IsTileWalkable(newGridX, newGridY, false)) {
+        ghosts[i].gridX = newGridX;
+        ghosts[i].gridY = newGridY;
+    } else {
+        ghosts[i].direction = DIR_NONE;
+    }
+}
+
+// Teleports a ghost through the side tunnel (rows 12 and 13, columns 0 and 27), elapsed being
+// the fraction of the tick already travelled
+static void handle_ghost_tunnel(Ghost *ghost, float elapsed) {
+    if ((ghost->gridY == 12 || ghost->gridY == 13)) {
+        if (ghost->gridX <= 0 && ghost->direction == DIR_LEFT) {
+            ghost->gridX = MAZE_WIDTH - 1;       // Teleport to right side
+            ghost->x = ghost->gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+            BeginMotionPath(&ghost->path, ghost->x, ghost->y, elapsed);    // Don't sweep across the whole maze
+        } else if (ghost->gridX >= MAZE_WIDTH - 1 && ghost->direction == DIR_RIGHT) {
+            ghost->gridX = 0;                    // Teleport to left side
+            ghost->x = ghost->gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+            BeginMotionPath(&ghost->path, ghost->x, ghost->y, elapsed);
         }
     }
 }
@@ -177,8 +586,7 @@ void update_ghost_mode(void) {
 // Update Ghosts
 // ----------------------------------------------------------------------------------------
 void update_ghosts(void) {
-    float deltaTime = GetFrameTime();
-    static float collisionCooldown = 0.0f;      // Cooldown to prevent multiple collisions in single frame
+    float deltaTime = simDeltaTime;
 
     // Skip updates during ghost eaten animation
     if (gameState == STATE_GHOST_EATEN) {
@@ -225,13 +633,19 @@ void update_ghosts(void) {
         }
     }
     
+    // Start this tick's paths for swept collision against Pac-Man
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        BeginMotionPath(&ghosts[i].path, ghosts[i].x, ghosts[i].y, 0.0f);
+    }
+
     // Check for collisions first to handle multiple simultaneous ghost collisions
+    // (ghosts haven't moved yet this tick, so only Pac-Man's motion is swept)
     bool ghostsToEat[MAX_GHOSTS] = {false};
     int numGhostsToEat = 0;
     if (collisionCooldown <= 0.0f) {
         for (int i = 0; i < MAX_GHOSTS; i ++) {
             if (ghosts[i].state == GHOST_FRIGHTENED && 
-                CheckCollision(ghosts[i].x, ghosts[i].y, pacman.x, pacman.y, TILE_SIZE / 2.0f)) {
+                ghost_touches_pacman(&ghosts[i])) {
                 ghostsToEat[i] = true;
                 numGhostsToEat ++;
                 printf("Ghost %d collision detected! eatenGhostCount: %d\n", i, eatenGhostCount + 1);
@@ -243,19 +657,7 @@ void update_ghosts(void) {
     if (numGhostsToEat > 0) {
         for (int i = 0; i < MAX_GHOSTS; i ++) {
             if (ghostsToEat[i]) {
-                ghosts[i].state = GHOST_RETURNING;
-                eatenGhostCount ++;
-                totalGhostsEaten ++;
-                int points = 200 * (1 << (eatenGhostCount - 1));    // 200, 400, 800, 1600
-                pacman.score += points;
-                PlaySound(sfx_eat_ghost);
-                // Debug print for the added score
-                printf("Ghost %d eaten! Added %d points. Total score: %d (eatenGhostCount: %d)\n", 
-                       i, points, pacman.score, eatenGhostCount);
-                eatenGhostIndex = i;
-                gameState = STATE_GHOST_EATEN;
-                ghostEatenTimer = 1.0f;     // 1 sec pause
-                collisionCooldown = 0.5f;   // Preven immediate re-collision
+                eat_ghost(i);
                 break;
             }
         }
@@ -273,21 +675,26 @@ void update_ghosts(void) {
                 ghosts[i].direction = DIR_UP; // Move up to exit the pen
             }
             // Move up and down within the pen until released
-            if (ghosts[i].y <= (11 * TILE_SIZE + TILE_SIZE / 2.0f)) {
+            float penTop = 11 * TILE_SIZE + TILE_SIZE / 2.0f;
+            float penBottom = 12 * TILE_SIZE + TILE_SIZE / 2.0f;
+            if (ghosts[i].y <= penTop) {
                 ghosts[i].direction = DIR_DOWN;
-            } else if (ghosts[i].y >= (12 * TILE_SIZE + TILE_SIZE / 2.0f)) {
+            } else if (ghosts[i].y >= penBottom) {
                 ghosts[i].direction = DIR_UP;
             }
 
-            switch (ghosts[i].direction) {
-                case DIR_UP:
-                    ghosts[i].y -= currentSpeed * deltaTime;
-                    break;
-                case DIR_DOWN:
-                    ghosts[i].y += currentSpeed * deltaTime;
-                    break;   
-                default:
+            // Turn exactly at each end, however far the ghost moves this tick
+            float remaining = currentSpeed * deltaTime;
+            while (remaining > 0.0f && (ghosts[i].direction == DIR_UP || ghosts[i].direction == DIR_DOWN)) {
+                bool up = ghosts[i].direction == DIR_UP;
+                float toEnd = up ? ghosts[i].y - penTop : penBottom - ghosts[i].y;
+                if (remaining < toEnd) {
+                    ghosts[i].y += up ? -remaining : remaining;
                     break;
+                }
+                ghosts[i].y = up ? penTop : penBottom;
+                ghosts[i].direction = up ? DIR_DOWN : DIR_UP;
+                remaining -= toEnd;
             }
             continue;
         }
@@ -308,398 +715,80 @@ void update_ghosts(void) {
             int penX = 14;
             int penY = 11;
 
-            // Check if ghost has reached pen
-            if (ghosts[i].gridX == penX && ghosts[i].gridY == penY) {
-                ghosts[i].state = GHOST_PENNED;
-                ghosts[i].stateTimer = 2.0f;        // Wait in pen for 2 secs before exiting
-                ghosts[i].x = penX * TILE_SIZE + TILE_SIZE / 2.0f;
-                ghosts[i].y = penY * TILE_SIZE + TILE_SIZE / 2.0f;
-                ghosts[i].stuckTimer = 0.0f;        // Reset stuck timer
-                printf("Ghost %d reached pen at (%d, %d)\n", i, penX, penY);
-                continue;
-            }
-
-            // Check if ghost is centered in the current tile
-            float centerX = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-            float centerY = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
-            bool atCenter = fabs(ghosts[i].x - centerX) < 1.0f && fabs(ghosts[i].y - centerY) < 1.0f;
-
-            if (atCenter) {
-                ghosts[i].x = centerX;
-                ghosts[i].y = centerY;
-
-                // Choose direction to return to pen
-                ghosts[i].direction = choose_best_direction(ghosts[i].gridX, ghosts[i].gridY, penX, penY, ghosts[i].direction, true);
-
-                // Debug: Log the ghost's position and direction
-                printf("Ghost %d at (%d, %d), Direction: %d\n", i, ghosts[i].gridX, ghosts[i].gridY, ghosts[i].direction);
-                
-                // Update stuck timer
-                if (ghosts[i].direction == DIR_NONE) {
-                    ghosts[i].stuckTimer += deltaTime;
-                    // Debug: Log when the ghost is stuck
-                    printf("Ghost %d is stuck at (%d, %d), Stuck Timer: %.2f\n", i, ghosts[i].gridX, ghosts[i].gridY, ghosts[i].stuckTimer);
-                } else {
-                    ghosts[i].stuckTimer = 0.0f; // Reset timer if moving
-                }
-
-                // If stuck for too long, force a random valid direction
-                if (ghosts[i].stuckTimer > 1.0f) { // Stuck for 1 second
-                    Direction possibleDirs[4] = {DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT};
-                    int validDirs[4] = {0};
-                    int validCount = 0;
-
-                    for (int d = 0; d < 4; d++) {
-                        int newGridX = ghosts[i].gridX;
-                        int newGridY = ghosts[i].gridY;
-                        switch (possibleDirs[d]) {
-                            case DIR_UP:
-                                newGridY--;
-                                break;
-                            case DIR_DOWN:
-                                newGridY++;
-                                break;
-                            case DIR_LEFT:
-                                newGridX--;
-                                break;
-                            case DIR_RIGHT:
-                                newGridX++;
-                                break;
-                            default:
-                                break;
-                        }
-
-                        if (IsTileWalkable(newGridX, newGridY, true)) {
-                            validDirs[validCount] = d;
-                            validCount++;
-                        }
-                    }
-
-                    if (validCount > 0) {
-                        ghosts[i].direction = possibleDirs[validDirs[rand() % validCount]];
-                        ghosts[i].stuckTimer = 0.0f; // Reset stuck timer
-                        // Debug: Log when forcing a new direction
-                        printf("Ghost %d was stuck, forcing new direction: %d\n", i, ghosts[i].direction);
-                    }
-                }
-                
-                // Update grid position based on direction, but only if the next tile is walkable
-                int newGridX = ghosts[i].gridX;
-                int newGridY = ghosts[i].gridY;
-                switch (ghosts[i].direction) {
-                    case DIR_UP:
-                        newGridY--;
-                        break;
-                    case DIR_DOWN:
-                        newGridY++;
-                        break;
-                    case DIR_LEFT:
-                        newGridX--;
-                        break;
-                    case DIR_RIGHT:
-                        newGridX++;
-                        break;
-                    default:
+            // Travel centre to centre, carrying leftover distance into the next tile
+            float distance = currentSpeed * deltaTime;
+            float remaining = distance;
+            bool reachedPen = false;
+            while (true) {
+                if (IsAtTileCenter(ghosts[i].x, ghosts[i].y, ghosts[i].gridX, ghosts[i].gridY)) {
+                    ghosts[i].x = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+                    ghosts[i].y = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
+
+                    // Check if ghost has reached the centre of the pen tile
+                    if (ghosts[i].gridX == penX && ghosts[i].gridY == penY) {
+                        reachedPen = true;
                         break;
+                    }
+                    steer_returning_ghost(i, deltaTime);
                 }
 
-                if (IsTileWalkable(newGridX, newGridY, true)) {
-                    ghosts[i].gridX = newGridX;
-                    ghosts[i].gridY = newGridY;
-                } else {
-                    ghosts[i].direction = DIR_NONE;
+                if (ghosts[i].direction == DIR_NONE || remaining <= 0.0f) {
+                    break;
                 }
+                remaining = advance_ghost(&ghosts[i], remaining, distance);
             }
-
-            // Move ghost towards the center of the next tile
-            float targetX = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-            float targetY = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
-            float moveDist = currentSpeed * deltaTime;
-
-            switch (ghosts[i].direction) {
-                case DIR_UP:
-                    ghosts[i].y -= moveDist;
-                    if (ghosts[i].y < targetY) ghosts[i].y = targetY;
-                    break;
-                case DIR_DOWN:
-                    ghosts[i].y += moveDist;
-                    if (ghosts[i].y > targetY) ghosts[i].y = targetY;
-                    break;
-                case DIR_LEFT:
-                    ghosts[i].x -= moveDist;
-                    if (ghosts[i].x < targetX) ghosts[i].x = targetX;
-                    break;
-                case DIR_RIGHT:
-                    ghosts[i].x += moveDist;
-                    if (ghosts[i].x > targetX) ghosts[i].x = targetX;
-                    break;
-                default:
-                    break;
+            if (reachedPen) {
+                ghosts[i].state = GHOST_PENNED;
+                ghosts[i].stateTimer = 2.0f;        // Wait in pen for 2 secs before exiting
+                ghosts[i].stuckTimer = 0.0f;        // Reset stuck timer
+                printf("Ghost %d reached pen at (%d, %d)\n", i, penX, penY);
             }
             continue;   // Skip normal movement logic while returning
         }
 
-        // Check if ghost is centered in the current tile
-        float centerX = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-        float centerY = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
-        bool atCenter = fabs(ghosts[i].x - centerX) < 1.0f && fabs(ghosts[i].y - centerY) < 1.0f;
-
-        // Determine if the ghost is still exiting the pen (not yet above the gate)
-        bool isExitingPen = (ghosts[i].gridY >= 11 && ghosts[i].gridY <= 12 && ghosts[i].state == GHOST_NORMAL &&
-            ghosts[i].gridX >= 13 && ghosts[i].gridX <= 14);
-
-        if (atCenter) {
-            // Snap position to center to prevent drift
-            ghosts[i].x = centerX;
-            ghosts[i].y = centerY;
-
-            // If exiting pen, guide ghost to exit point (row 11, column 14)
-            if (isExitingPen) {
-                int exitX = 14;
-                int exitY = 11;
-                if (ghosts[i].gridY > 11) {
-                    ghosts[i].direction = DIR_UP;
-                    ghosts[i].gridY--;
-                } else if (ghosts[i].gridX < exitX) {
-                    ghosts[i].direction = DIR_RIGHT;
-                    ghosts[i].gridX++;
-                } else if (ghosts[i].gridX > exitX) {
-                    ghosts[i].direction = DIR_LEFT;
-                    ghosts[i].gridX--;
-                } else {
-                    ghosts[i].direction = DIR_UP;
-                    ghosts[i].gridY--;
-                }
-                continue;
-            }
-
-            // Determine target
-            int targetX, targetY;
-            if (ghosts[i].state == GHOST_FRIGHTENED) {
-                // Random movement: Choose a random valid direction
-                Direction possibleDirs[4] = {DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT};
-                int validDirs[4] = {0};
-                int validCount = 0;
-
-                for (int d = 0; d < 4; d++) {
-                    int newGridX = ghosts[i].gridX;
-                    int newGridY = ghosts[i].gridY;
-                    switch (possibleDirs[d]) {
-                        case DIR_UP:
-                            newGridY--;
-                            break;
-                        case DIR_DOWN:
-                            newGridY++;
-                            break;
-                        case DIR_LEFT:
-                            newGridX--;
-                            break;
-                        case DIR_RIGHT:
-                            newGridX++;
-                            break;
-                        default:
-                            break;
-                    }
+        // Travel centre to centre, making a decision at every tile centre reached this tick
+        // so that turns never depend on how far the ghost moves per frame
+        float distance = currentSpeed * deltaTime;
+        float remaining = distance;
+        while (true) {
+            if (IsAtTileCenter(ghosts[i].x, ghosts[i].y, ghosts[i].gridX, ghosts[i].gridY)) {
+                // Snap position to center to prevent drift
+                ghosts[i].x = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+                ghosts[i].y = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
 
-                    // Use utility function to check if the tile is walkable
-                    if (IsTileWalkable(newGridX, newGridY, false)) {
-                        // Avoid moving back in the opposite direction (prevents jittering)
-                        Direction oppositeDir = DIR_NONE;
-                        switch (ghosts[i].direction) {
-                            case DIR_UP:    oppositeDir = DIR_DOWN; break;
-                            case DIR_DOWN:  oppositeDir = DIR_UP; break;
-                            case DIR_LEFT:  oppositeDir = DIR_RIGHT; break;
-                            case DIR_RIGHT: oppositeDir = DIR_LEFT; break;
-                            default: break;
-                        }
-                        if (possibleDirs[d] != oppositeDir || validCount == 0) {
-                            validDirs[validCount] = d;
-                            validCount++;
-                        }
-                    }
-                }
+                // Determine if the ghost is still exiting the pen (not yet above the gate)
+                bool isExitingPen = (ghosts[i].gridY >= 11 && ghosts[i].gridY <= 12 && ghosts[i].state == GHOST_NORMAL &&
+                    ghosts[i].gridX >= 13 && ghosts[i].gridX <= 14);
 
-                if (validCount > 0) {
-                    ghosts[i].direction = possibleDirs[validDirs[rand() % validCount]];
+                if (isExitingPen) {
+                    steer_ghost_out_of_pen(i);
                 } else {
-                    ghosts[i].direction = DIR_NONE;
+                    choose_ghost_direction(i);
                 }
-
-            } else {
-                
-                // Normal behavior (Chase or Scatter)
-                bool isBlinky = (i == 0);       // Blinky is ghost 0
-                float pelletRatio = (float)remainingPelletCount / initialPelletCount;
-
-                if (isBlinky && (level >= 3 || pelletRatio < 0.2f)) {
-                    targetX = pacman.gridX;
-                    targetY = pacman.gridY;
-                } else if (ghostMode == MODE_SCATTER) {
-                    targetX = ghosts[i].scatterTargetX;
-                    targetY = ghosts[i].scatterTargetY;
-                } else {    // MODE_CHASE
-                    switch (i) {
-                        case 0:     // Blinky: Direct chase
-                            targetX = pacman.gridX;
-                            targetY = pacman.gridY;
-                            break;
-                        
-                        case 1:     // Pinky: Ambush (4 tiles ahead of Pac-Man)
-                            targetX = pacman.gridX;
-                            targetY = pacman.gridY;
-                            switch (pacman.direction) {
-                                case DIR_UP:
-                                    targetY -= 4;
-                                    break;
-                                case DIR_DOWN:
-                                    targetY += 4;
-                                    break;
-                                case DIR_LEFT:
-                                    targetX -= 4;
-                                    break;
-                                case DIR_RIGHT:
-                                    targetX += 4;
-                                    break;
-                                default:
-                                    break;
-                            }
-                            break;
-
-                        case 2:     // Inky: Complex targeting
-                        {
-                            // Target is 2 tiles ahead of Pac-Man
-                            int intermediateX = pacman.gridX;
-                            int intermediateY = pacman.gridY;
-                            switch (pacman.direction) {
-                                case DIR_UP:
-                                    intermediateY -= 2;
-                                    break;
-                                case DIR_DOWN:
-                                    intermediateY += 2;
-                                    break;
-                                case DIR_LEFT:
-                                    intermediateX -= 2;
-                                    break;
-                                case DIR_RIGHT:
-                                    intermediateX += 2;
-                                    break;
-                                default:
-                                    break;
-                            }
-                            // Vector from Blinky to intermediate point
-                            int vecX = intermediateX - ghosts[0].gridX;
-                            int vecY = intermediateY - ghosts[0].gridY;
-                            // Target is intermediate point + vector
-                            targetX = intermediateX + vecX;
-                            targetY = intermediateY + vecY;
-                            break;
-                        }
-                        
-                        case 3:     // Clyde: Chase or scatter based on distance
-                        {
-                            float dist = CalculateDistance(ghosts[i].gridX, ghosts[i].gridY, pacman.gridX, pacman.gridY);
-                            if (dist > 8) {
-                                // Chase Pac-Man
-                                targetX = pacman.gridX;
-                                targetY = pacman.gridY;
-                            } else {
-                                // Scatter to bottom-left
-                                targetX = ghosts[i].scatterTargetX;
-                                targetY = ghosts[i].scatterTargetY;
-                            }
-                            break;
-                        }
-
-                        default:
-                            targetX = pacman.gridX;
-                            targetY = pacman.gridY;
-                            break;
-                    }
-                }
-
-                // Ensure target is within bounds
-                targetX = (targetX < 0) ? 0 : (targetX >= MAZE_WIDTH ? MAZE_WIDTH - 1 : targetX);
-                targetY = (targetY < 0) ? 0 : (targetY >= MAZE_HEIGHT ? MAZE_HEIGHT - 1 : targetY);
-
-                // Choose the best direction toward the target
-                ghosts[i].direction = choose_best_direction(ghosts[i].gridX, ghosts[i].gridY, targetX, targetY, ghosts[i].direction, false);
-            }
-
-            // Update grid position based on direction, but only if the next tile is walkable
-            int newGridX = ghosts[i].gridX;
-            int newGridY = ghosts[i].gridY;
-            switch (ghosts[i].direction) {
-                case DIR_UP:
-                    newGridY--;
-                    break;
-                case DIR_DOWN:
-                    newGridY++;
-                    break;
-                case DIR_LEFT:
-                    newGridX--;
-                    break;
-                case DIR_RIGHT:
-                    newGridX++;
-                    break;
-                default:
-                    break;
             }
 
-            if (IsTileWalkable(newGridX, newGridY, false)) {
-                ghosts[i].gridX = newGridX;
-                ghosts[i].gridY = newGridY;
-            } else {
-                ghosts[i].direction = DIR_NONE;
-            }
-        }
+            handle_ghost_tunnel(&ghosts[i], (distance > 0.0f) ? 1.0f - remaining / distance : 0.0f);
 
-        // Handle tunnel (rows 12 and 13, columns 0 and 27)
-        if ((ghosts[i].gridY == 12 || ghosts[i].gridY == 13)) {
-            if (ghosts[i].gridX <= 0 && ghosts[i].direction == DIR_LEFT) {
-                ghosts[i].gridX = MAZE_WIDTH - 1;       // Teleport to right side
-                ghosts[i].x = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-            } else if (ghosts[i].gridX >= MAZE_WIDTH - 1 && ghosts[i].direction == DIR_RIGHT) {
-                ghosts[i].gridX = 0;                    // Teleport to left side
-                ghosts[i].x = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+            if (ghosts[i].direction == DIR_NONE || remaining <= 0.0f) {
+                break;
             }
+            remaining = advance_ghost(&ghosts[i], remaining, distance);
         }
-
-        // Move ghost towards the center of the next tile
-        float targetX = ghosts[i].gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-        float targetY = ghosts[i].gridY * TILE_SIZE + TILE_SIZE / 2.0f;
-        float moveDist = currentSpeed * deltaTime;
-
-        switch (ghosts[i].direction) {
-            case DIR_UP:
-                ghosts[i].y -= moveDist;
-                if (ghosts[i].y < targetY) ghosts[i].y = targetY;
+        // Collision with Pac-Man, swept over both of their movements this tick
+        if (collisionCooldown <= 0.0f && ghost_touches_pacman(&ghosts[i])) {
+            if (ghosts[i].state == GHOST_NORMAL) {
+                gameState = STATE_DEATH_ANIM;
+                deathAnimTimer = 1.0f;
+                deathAnimFrame = 0;
+                collisionCooldown = 1.0f; // Longer cooldown for death
+                playPacmanMove = false;
+                StopSound(sfx_pacman_move);
                 break;
-            case DIR_DOWN:
-                ghosts[i].y += moveDist;
-                if (ghosts[i].y > targetY) ghosts[i].y = targetY;
+            } else if (ghosts[i].state == GHOST_FRIGHTENED) {
+                // Frightened ghost ran into Pac-Man during its own move
+                eat_ghost(i);
                 break;
-            case DIR_LEFT:
-                ghosts[i].x -= moveDist;
-                if (ghosts[i].x < targetX) ghosts[i].x = targetX;
-                break;
-            case DIR_RIGHT:
-                ghosts[i].x += moveDist;
-                if (ghosts[i].x > targetX) ghosts[i].x = targetX;
-                break;
-            default:
-                break;
-        }
-  
-        // Collision with Pac-Man (handled above for frightened ghosts)
-        if (collisionCooldown <= 0.0f && ghosts[i].state == GHOST_NORMAL &&
-            CheckCollision(ghosts[i].x, ghosts[i].y, pacman.x, pacman.y, TILE_SIZE / 2.0f)) {
-            gameState = STATE_DEATH_ANIM;
-            deathAnimTimer = 1.0f;
-            deathAnimFrame = 0;
-            collisionCooldown = 1.0f; // Longer cooldown for death
-            playPacmanMove = false;
-            StopSound(sfx_pacman_move);
-            break;
+            }
         }
     }
 
@@ -0,0 +1,113 @@
+#include "game_logic.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Bitboard Helpers
+// --------------------------------------------------------------------------------------------------------------------------
+
+// Number of set bits in one maze row
+static int popcount_row(uint32_t row) {
+#if defined(_MSC_VER)
+    return (int)__popcnt(row);
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(row);
+#else
+    int count = 0;
+    while (row) {
+        row &= row - 1;     // Clear the lowest set bit
+        count ++;
+    }
+    return count;
+#endif
+}
+
+// Tile Access
+// --------------------------------------------------------------------------------------------------------------------------
+
+void clear_maze_board(void) {
+    memset(&maze, 0, sizeof(maze));
+    tileJournal.overflowed = true;  // Every tile may have changed
+}
+
+TileType get_tile(int x, int y) {
+    if (x < 0 || x >= MAZE_WIDTH || y < 0 || y >= MAZE_HEIGHT) {
+        return EMPTY;
+    }
+    uint32_t bit = 1u << x;
+    if (maze.walls[y] & bit) return WALL;
+    if (maze.pellets[y] & bit) return PELLET;
+    if (maze.powerPellets[y] & bit) return POWER_PELLET;
+    if (maze.gates[y] & bit) return GHOST_GATE;
+    return EMPTY;
+}
+
+void set_tile(int x, int y, TileType type) {
+    if (x < 0 || x >= MAZE_WIDTH || y < 0 || y >= MAZE_HEIGHT) {
+        return;
+    }
+    TileType oldType = get_tile(x, y);
+    if (oldType == type) {
+        return;
+    }
+    uint32_t bit = 1u << x;
+
+    // A tile holds exactly one type, so clear it from every board first
+    maze.walls[y] &= ~bit;
+    maze.pellets[y] &= ~bit;
+    maze.powerPellets[y] &= ~bit;
+    maze.gates[y] &= ~bit;
+
+    switch (type) {
+        case WALL:
+            maze.walls[y] |= bit;
+            break;
+        case PELLET:
+            maze.pellets[y] |= bit;
+            break;
+        case POWER_PELLET:
+            maze.powerPellets[y] |= bit;
+            break;
+        case GHOST_GATE:
+            maze.gates[y] |= bit;
+            break;
+        default:
+            break;
+    }
+
+    // Journal the change for incremental consumers (renderers, replays, ...).
+    // Once overflowed the list is ignored until the next clear, so stop recording.
+    if (tileJournal.overflowed) {
+        return;
+    }
+    if (tileJournal.count < TILE_JOURNAL_CAPACITY) {
+        tileJournal.changes[tileJournal.count ++] = (TileChange){ (uint8_t)x, (uint8_t)y, (uint8_t)oldType, (uint8_t)type };
+    } else {
+        tileJournal.overflowed = true;
+    }
+}
+
+void clear_tile_journal(void) {
+    tileJournal.count = 0;
+    tileJournal.overflowed = false;
+}
+
+// Pellet Queries
+// --------------------------------------------------------------------------------------------------------------------------
+
+int count_maze_pellets(void) {
+    int count = 0;
+    for (int y = 0; y < MAZE_HEIGHT; y ++) {
+        count += popcount_row(maze.pellets[y] | maze.powerPellets[y]);
+    }
+    return count;
+}
+
+bool any_maze_pellets(void) {
+    uint32_t remaining = 0;
+    for (int y = 0; y < MAZE_HEIGHT; y ++) {
+        remaining |= maze.pellets[y] | maze.powerPellets[y];
+    }
+    return remaining != 0;
+}
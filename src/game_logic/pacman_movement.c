@@ -1,4 +1,5 @@
 #include "game_logic.h"
+#include "utils.h"
 
 // Initialize Pac-Man with difficulty-based speed
 // --------------------------------------------------------------------------------------------------------------------------
@@ -7,132 +8,23 @@ void init_pacman(int startX, int startY) {
     pacman.gridY = startY;
     pacman.x = startX * TILE_SIZE + TILE_SIZE / 2.0f;
     pacman.y = startY * TILE_SIZE + TILE_SIZE / 2.0f;
+    BeginMotionPath(&pacman.path, pacman.x, pacman.y, 0.0f);
 
     pacman.speed = 120.0f;      // Pixels per second (approx 6 tiles/sec)
     pacman.score = 0;
     pacman.lives = 3;
     pacman.direction = DIR_RIGHT;
     pacman.nextDirection = DIR_RIGHT;
+    pacman.animTimer = 0.0f;
+    pacman.currentFrame = 0;
 }
 
-// Update position and handle pellet collection
-void update_pacman(void) {
-    float deltaTime = GetFrameTime();           // Ensuring frame-rate-independent movement
-    static int lastScore = 0;                   // Track score to detect extra life
-
-    // Queue the next direction
-    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) pacman.nextDirection = DIR_RIGHT;
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) pacman.nextDirection = DIR_LEFT;
-    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) pacman.nextDirection = DIR_UP;
-    if (IsKeyDown(KEY_DOWN) ||  IsKeyDown(KEY_S)) pacman.nextDirection = DIR_DOWN;
-
-    // Check if Pac-Man is centered in the current tile
-    float centerX = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-    float centerY = pacman.gridY * TILE_SIZE + TILE_SIZE / 2.0f;
-    bool atCenter = fabs(pacman.x - centerX) < 1.0f && fabs(pacman.y - centerY) < 1.0f;
-
-    if (atCenter) {
-        // Try to change direction
-        int newGridX = pacman.gridX;
-        int newGridY = pacman.gridY;
-        switch (pacman.nextDirection) {
-            case DIR_UP:
-                newGridY--;
-                break;
-            case DIR_DOWN:
-                newGridY++;
-                break;
-            case DIR_LEFT:
-                newGridX--;
-                break;
-            case DIR_RIGHT:
-                newGridX++;
-                break;
-            default:
-                break;
-        }
-
-        // Check if the next direction is valid
-        if (newGridX >= 0 && newGridX < MAZE_WIDTH && newGridY >= 0 && newGridY < MAZE_HEIGHT &&
-            maze[newGridY][newGridX] != WALL) {
-            pacman.direction = pacman.nextDirection;
-            pacman.gridX = newGridX;
-            pacman.gridY = newGridY;
-        } else {
-            // Try to continue in current direction
-            newGridX = pacman.gridX;
-            newGridY = pacman.gridY;
-            switch (pacman.direction) {
-                case DIR_UP:
-                    newGridY--;
-                    break;
-                case DIR_DOWN:
-                    newGridY++;
-                    break;
-                case DIR_LEFT:
-                    newGridX--;
-                    break;
-                case DIR_RIGHT:
-                    newGridX++;
-                    break;
-                default:
-                    break;
-            }
-
-            if (newGridX >= 0 && newGridX < MAZE_WIDTH && newGridY >= 0 && newGridY < MAZE_HEIGHT &&
-                maze[newGridY][newGridX] != WALL) {
-                pacman.gridX = newGridX;
-                pacman.gridY = newGridY;
-            } else {
-                pacman.direction = DIR_NONE; // Stop if blocked
-            }
-        }
-    }
-
-    // Handle tunnel (rows 12 and 13, columns 0 and 27)
-    if ((pacman.gridY == 12 || pacman.gridY == 13)) {
-        if (pacman.gridX <= 0 && pacman.direction == DIR_LEFT) {
-            pacman.gridX = MAZE_WIDTH - 1;      // Teleport to right side
-            pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-        } else if (pacman.gridX >= MAZE_WIDTH -1 && pacman.direction == DIR_RIGHT) {
-            pacman.gridX = 0;                   // Teleport to left side
-            pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
-        }
-    }
-
-    // Move Pac-Man
-    switch (pacman.direction) {
-        case DIR_UP:
-            pacman.y -= pacman.speed * deltaTime;
-            break;
-        case DIR_DOWN:
-            pacman.y += pacman.speed * deltaTime;
-            break;
-        case DIR_LEFT:
-            pacman.x -= pacman.speed * deltaTime;
-            break;
-        case DIR_RIGHT:
-            pacman.x += pacman.speed * deltaTime;
-            break;
-        default:
-            break;
-    }
-
-    // Update grid position
-    pacman.gridX = (int)(pacman.x / TILE_SIZE);
-    pacman.gridY = (int)(pacman.y / TILE_SIZE);
-
-    // Check for extra life (at 10,000 pts and 20,000 pts)
-    if (pacman.score >= 10000 && lastScore < 10000 || 
-        pacman.score >= 20000 && lastScore < 20000) {
-        pacman.lives ++;
-        PlaySound(sfx_extra_life);
-    }
-    lastScore = pacman.score;
-    
-    // Handle pellet collection
-    if (maze[pacman.gridY][pacman.gridX] == PELLET) {
-        maze[pacman.gridY][pacman.gridX] = EMPTY;
+// Eats whatever pellet is on Pac-Man's current tile.
+// Returns true if that cleared the maze and ended the level.
+static bool collect_pellet(void) {
+    TileType tile = get_tile(pacman.gridX, pacman.gridY);
+    if (tile == PELLET) {
+        set_tile(pacman.gridX, pacman.gridY, EMPTY);
         pacman.score += 10;
         pelletsEaten ++;
         remainingPelletCount --;
@@ -148,10 +40,10 @@ void update_pacman(void) {
             }
             isFrightenedSoundPaused = false;
             PlaySound(sfx_level_complete);
-            return;
+            return true;
         }
-    } else if (maze[pacman.gridY][pacman.gridX] == POWER_PELLET) {
-        maze[pacman.gridY][pacman.gridX] = EMPTY;
+    } else if (tile == POWER_PELLET) {
+        set_tile(pacman.gridX, pacman.gridY, EMPTY);
         pacman.score += 50;
         powerPelletsEaten ++;
         remainingPelletCount --;
@@ -184,7 +76,200 @@ void update_pacman(void) {
             }
             isFrightenedSoundPaused = false;
             PlaySound(sfx_level_complete);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Chooses Pac-Man's direction at a tile centre: the queued turn if it is open,
+// otherwise carry straight on, otherwise stop against the wall.
+static void choose_pacman_direction(void) {
+    // Try to change direction
+    int newGridX = pacman.gridX;
+    int newGridY = pacman.gridY;
+    switch (pacman.nextDirection) {
+        case DIR_UP:
+            newGridY--;
+            break;
+        case DIR_DOWN:
+            newGridY++;
+            break;
+        case DIR_LEFT:
+            newGridX--;
+            break;
+        case DIR_RIGHT:
+            newGridX++;
+            break;
+        default:
+            break;
+    }
+
+    // Check if the next direction is valid
+    if (newGridX >= 0 && newGridX < MAZE_WIDTH && newGridY >= 0 && newGridY < MAZE_HEIGHT &&
+        get_tile(newGridX, newGridY) != WALL) {
+        pacman.direction = pacman.nextDirection;
+        return;
+    }
+
+    // Try to continue in current direction
+    newGridX = pacman.gridX;
+    newGridY = pacman.gridY;
+    switch (pacman.direction) {
+        case DIR_UP:
+            newGridY--;
+            break;
+        case DIR_DOWN:
+            newGridY++;
+            break;
+        case DIR_LEFT:
+            newGridX--;
+            break;
+        case DIR_RIGHT:
+            newGridX++;
+            break;
+        default:
+            break;
+    }
+
+    if (!(newGridX >= 0 && newGridX < MAZE_WIDTH && newGridY >= 0 && newGridY < MAZE_HEIGHT &&
+          get_tile(newGridX, newGridY) != WALL)) {
+        pacman.direction = DIR_NONE; // Stop if blocked
+    }
+}
+
+// Distance from a coordinate to the next tile centre ahead of it along one axis (step is +1 or -1).
+// A coordinate already on a centre is a full tile away from the next one.
+static float distance_to_next_center(float pos, int step) {
+    float tile = (pos - TILE_SIZE / 2.0f) / TILE_SIZE;
+    float next = (step > 0) ? floorf(tile + 1.0f) : ceilf(tile - 1.0f);
+    return fabsf(next * TILE_SIZE + TILE_SIZE / 2.0f - pos);
+}
+
+// Read the direction key held down; with several held, down wins over up, left and right
+Direction read_direction_input(void) {
+    if (IsKeyDown(KEY_DOWN) ||  IsKeyDown(KEY_S)) return DIR_DOWN;
+    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) return DIR_UP;
+    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) return DIR_LEFT;
+    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) return DIR_RIGHT;
+    return DIR_NONE;
+}
+
+// Random demo steering for runs without a player
+void steer_autopilot(void) {
+    if (!IsAtTileCenter(pacman.x, pacman.y, pacman.gridX, pacman.gridY)) {
+        return;
+    }
+
+    static const Direction reverse[5] = { DIR_NONE, DIR_DOWN, DIR_UP, DIR_RIGHT, DIR_LEFT };
+    static const int stepX[5] = { 0, 0, 0, -1, 1 };
+    static const int stepY[5] = { 0, -1, 1, 0, 0 };
+
+    Direction options[4];
+    int count = 0;
+    for (Direction dir = DIR_UP; dir <= DIR_RIGHT; dir++) {
+        if (dir != reverse[pacman.direction] &&
+            IsTileWalkable(pacman.gridX + stepX[dir], pacman.gridY + stepY[dir], false)) {
+            options[count ++] = dir;
+        }
+    }
+    pacman.nextDirection = (count > 0) ? options[GetRandomValue(0, count - 1)] : reverse[pacman.direction];
+}
+
+// Update position and handle pellet collection
+void update_pacman(void) {
+    float deltaTime = simDeltaTime;             // Ensuring frame-rate-independent movement
+
+    // Record this tick's path, corner by corner, for swept collision against ghosts
+    BeginMotionPath(&pacman.path, pacman.x, pacman.y, 0.0f);
+
+    // Move in segments that end exactly on tile centres, carrying any leftover distance into
+    // the next segment, so turns and pellet pickups are the same at any speed or frame time
+    float distance = pacman.speed * deltaTime;
+    float remaining = distance;
+    while (true) {
+        // Handle tunnel (rows 12 and 13, columns 0 and 27), part-way through the tick
+        if ((pacman.gridY == 12 || pacman.gridY == 13)) {
+            float elapsed = (distance > 0.0f) ? 1.0f - remaining / distance : 0.0f;
+            if (pacman.gridX <= 0 && pacman.direction == DIR_LEFT) {
+                pacman.gridX = MAZE_WIDTH - 1;      // Teleport to right side
+                pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+                BeginMotionPath(&pacman.path, pacman.x, pacman.y, elapsed);    // Don't sweep across the whole maze
+            } else if (pacman.gridX >= MAZE_WIDTH -1 && pacman.direction == DIR_RIGHT) {
+                pacman.gridX = 0;                   // Teleport to left side
+                pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+                BeginMotionPath(&pacman.path, pacman.x, pacman.y, elapsed);
+            }
+        }
+
+        // Pac-Man can only turn when centred in the current tile
+        if (IsAtTileCenter(pacman.x, pacman.y, pacman.gridX, pacman.gridY)) {
+            pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+            pacman.y = pacman.gridY * TILE_SIZE + TILE_SIZE / 2.0f;
+            choose_pacman_direction();
+        }
+
+        if (pacman.direction == DIR_NONE || remaining <= 0.0f) {
+            break;
+        }
+
+        // Move Pac-Man up to the next tile centre
+        float toCenter;
+        switch (pacman.direction) {
+            case DIR_UP:    toCenter = distance_to_next_center(pacman.y, -1); break;
+            case DIR_DOWN:  toCenter = distance_to_next_center(pacman.y, 1);  break;
+            case DIR_LEFT:  toCenter = distance_to_next_center(pacman.x, -1); break;
+            default:        toCenter = distance_to_next_center(pacman.x, 1);  break;
+        }
+        float step = (remaining < toCenter) ? remaining : toCenter;
+        remaining -= step;
+
+        switch (pacman.direction) {
+            case DIR_UP:
+                pacman.y -= step;
+                break;
+            case DIR_DOWN:
+                pacman.y += step;
+                break;
+            case DIR_LEFT:
+                pacman.x -= step;
+                break;
+            case DIR_RIGHT:
+                pacman.x += step;
+                break;
+            default:
+                break;
+        }
+
+        // Update grid position
+        int oldGridX = pacman.gridX;
+        int oldGridY = pacman.gridY;
+        pacman.gridX = (int)(pacman.x / TILE_SIZE);
+        pacman.gridY = (int)(pacman.y / TILE_SIZE);
+        if ((pacman.gridX != oldGridX || pacman.gridY != oldGridY) &&
+            pacman.gridX >= 0 && pacman.gridX < MAZE_WIDTH && pacman.gridY >= 0 && pacman.gridY < MAZE_HEIGHT) {
+            pacmanTileVisits[pacman.gridY][pacman.gridX] ++;    // AI overlay heatmap
+        }
+
+        // Land exactly on the centre so the next segment starts from it
+        if (step == toCenter) {
+            pacman.x = pacman.gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+            pacman.y = pacman.gridY * TILE_SIZE + TILE_SIZE / 2.0f;
+        }
+        AddMotionPoint(&pacman.path, pacman.x, pacman.y, 1.0f - remaining / distance);
+
+        // Each segment crosses at most one tile edge, so no pellet is ever skipped
+        if (collect_pellet()) {
             return;
         }
     }
+
+    // Check for extra life (at 10,000 pts and 20,000 pts)
+    if (pacman.score >= 10000 && lifeCheckScore < 10000 || 
+        pacman.score >= 20000 && lifeCheckScore < 20000) {
+        pacman.lives ++;
+        PlaySound(sfx_extra_life);
+    }
+    lifeCheckScore = pacman.score;
 }
\ No newline at end of file
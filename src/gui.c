@@ -1,5 +1,8 @@
 #include "gui.h"
 #include "rendering.h"
+#include "screen_layout.h"
+#include "sprite_frames.h"
+#include "text_cache.h"
 
 // Static variables for menu animations
 static float menuAnimTimer = 0.0f;
@@ -11,6 +14,16 @@ static int pacmanFrame = 0;
 static float ghostAnimTimer = 0.0f;
 static int ghostFrame = 0;
 
+// Faded maze background of the menu, cached with and without the blinking pellets
+static RenderTexture2D menuBackground[2] = { 0 };   // [0] pellets hidden, [1] pellets visible
+
+// Formatted strings, only rebuilt when the values behind them change
+static TextLabel highscoreLabels[MAX_HIGH_SCORES];
+static TextLabel levelSubtitleLabel;
+static TextLabel levelBreakdownLabels[4];           // Pellets, power pellets, ghosts, fruits
+static TextLabel finalScoreLabel;
+static TextLabel gameOverScoreLabels[MAX_HIGH_SCORES];
+
 // Initializes GUI-related variables, such as selected menu options.
 void init_gui(void) {
     // Initialize menu selection
@@ -18,6 +31,45 @@ void init_gui(void) {
     pauseMenuState = PAUSE_MENU_MAIN;
 }
 
+// Draws the faded maze pattern behind the menu.
+static void draw_menu_background(int screenWidth, int screenHeight, bool pellets) {
+    for (int y = 0; y < screenHeight; y += 20) {
+        for (int x = 0; x < screenWidth; x += 20) {
+            if ((x / 20 + y / 20) % 2 == 0) {
+                DrawRectangle(x, y, 10, 10, Fade(BLUE, 0.1f));
+            }
+            if (pellets && (x / 20 + y / 20) % 4 == 0) {
+                DrawCircle(x + 10, y + 10, 2, Fade(YELLOW, 0.5f));
+            }
+        }
+    }
+}
+
+// Renders both menu background variants once, so the menu only blits one of them per frame.
+// Parameters:
+//   screenWidth - Width of the screen in pixels.
+//   screenHeight - Height of the screen in pixels.
+void init_menu_background(int screenWidth, int screenHeight) {
+    unload_menu_background();   // Drawn again at the new size after a relayout
+    for (int i = 0; i < 2; i++) {
+        menuBackground[i] = LoadRenderTexture(screenWidth, screenHeight);
+        BeginTextureMode(menuBackground[i]);
+        ClearBackground(BLACK);
+        draw_menu_background(screenWidth, screenHeight, i == 1);
+        EndTextureMode();
+    }
+}
+
+// Unloads the cached menu backgrounds.
+void unload_menu_background(void) {
+    for (int i = 0; i < 2; i++) {
+        if (menuBackground[i].id != 0) {
+            UnloadRenderTexture(menuBackground[i]);
+            menuBackground[i] = (RenderTexture2D){ 0 };
+        }
+    }
+}
+
 // Handles input for the main menu (STATE_MENU), updating the selected option and triggering state changes.
 // Parameters:
 //   selectedOption - Pointer to the currently selected menu option (0: Start, 1: Highscores, etc.).
@@ -455,7 +507,7 @@ void handle_game_over_input(int *selectedOption) {
     }
 }
 
-void render_menu(int screenWidth, int screenHeight, Font font, int selectedOption, Texture2D pacmanSprite, Ghost* ghostArray) {
+void render_menu(const ScreenLayout *layout, Font font, int selectedOption, Texture2D pacmanSprite, Ghost* ghostArray) {
     ClearBackground(BLACK);
 
     // Update animation timers
@@ -484,55 +536,43 @@ void render_menu(int screenWidth, int screenHeight, Font font, int selectedOptio
 
     // Move Pac-Man sprite
     pacmanSpriteX += 100.0f * GetFrameTime(); // Move right at 100px/s
-    if (pacmanSpriteX > screenWidth + 32.0f) {
+    if (pacmanSpriteX > layout->menu.spriteWrapX) {
         pacmanSpriteX = -32.0f; // Reset to left
     }
 
-    // Draw faded maze background
-    for (int y = 0; y < screenHeight; y += 20) {
-        for (int x = 0; x < screenWidth; x += 20) {
-            if ((x / 20 + y / 20) % 2 == 0) {
-                DrawRectangle(x, y, 10, 10, Fade(BLUE, 0.1f));
-            }
-            if (pelletVisible && (x / 20 + y / 20) % 4 == 0) {
-                DrawCircle(x + 10, y + 10, 2, Fade(YELLOW, 0.5f));
-            }
-        }
-    }
+    // Draw faded maze background (cached, pellets blink by swapping textures)
+    Texture2D background = menuBackground[pelletVisible ? 1 : 0].texture;
+    DrawTextureRec(background, (Rectangle){ 0, 0, (float)background.width, -(float)background.height },
+                   (Vector2){ 0, 0 }, WHITE);
 
-    // Draw Pac-Man sprite with eating animation
+    // Draw Pac-Man sprite with eating animation, blended like the premultiplied atlas it comes from
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
     float scaleFactor = 32.0f / 16.0f; // Scale to 32x32 pixels
-    float pacmanXOffset = (pacmanFrame == 0) ? 0.0f : (pacmanFrame == 1) ? 18.0f : 36.0f;
-    Rectangle pacmanSourceRec = { pacmanXOffset, 0.0f, 16.0f, 16.0f };
-    Rectangle pacmanDestRec = { pacmanSpriteX, screenHeight / 4.0f - 16.0f, 32.0f, 32.0f };
+    Rectangle pacmanSourceRec = SPRITE_PACMAN[DIR_RIGHT][pacmanFrame];
+    Rectangle pacmanDestRec = { pacmanSpriteX, layout->menu.spriteY, 32.0f, 32.0f };
     Vector2 pacmanOrigin = { 16.0f, 16.0f };
     DrawTexturePro(pacmanSprite, pacmanSourceRec, pacmanDestRec, pacmanOrigin, 0.0f, WHITE);
 
     // Draw ghost sprites trailing Pac-Man
     for (int i = 0; i < MAX_GHOSTS; i++) {
-        float yOffset;
-        switch (i) {
-            case 0: yOffset = 64.0f; break; // Blinky (red)
-            case 1: yOffset = 80.0f; break; // Pinky (pink)
-            case 2: yOffset = 96.0f; break; // Inky (cyan)
-            case 3: yOffset = 112.0f; break; // Clyde (orange)
-            default: yOffset = 64.0f; break;
-        }
-        float xOffset = 4.0f + ghostFrame * 16.0f; // Right-facing sprite
-        Rectangle ghostSourceRec = { xOffset, yOffset, 16.0f, 16.0f };
-        Rectangle ghostDestRec = { pacmanSpriteX - 40.0f * (i + 1), screenHeight / 4.0f - 16.0f, 32.0f, 32.0f };
+        Rectangle ghostSourceRec = SPRITE_GHOST[i][DIR_RIGHT][ghostFrame];   // Right-facing sprite
+        Rectangle ghostDestRec = { pacmanSpriteX - 40.0f * (i + 1), layout->menu.spriteY, 32.0f, 32.0f };
         DrawTexturePro(ghostArray[i].normalSprite[ghostFrame], ghostSourceRec, ghostDestRec, pacmanOrigin, 0.0f, WHITE);
     }
+    EndBlendMode();
 
     // Draw menu items with pulsing effect
     const char *options[] = {"Start", "Highscores", "About", "Settings", "Exit"};
     float baseFontSize = 16.0f;
-    float startY = screenHeight / 2.0f - 40.0f;
-    for (int i = 0; i < 5; i++) {
+    for (int i = 0; i < LAYOUT_MENU_OPTIONS; i++) {
         float scale = (i == selectedOption) ? 1.0f + 0.2f * sinf(menuAnimTimer * 4.0f) : 1.0f;
         float fontSize = baseFontSize * scale;
-        Vector2 textSize = MeasureTextEx(font, options[i], fontSize, 1);
-        Vector2 textPos = { screenWidth / 2.0f - textSize.x / 2.0f, startY + i * 30.0f };
+
+        // Measured at the base size so the cache keeps one entry per option; glyph advances scale
+        // with the font size, the 1px spacing between the glyphs does not
+        float gaps = (float)(strlen(options[i]) - 1);
+        float textWidth = (MeasureTextCached(font, options[i], baseFontSize, 1).x - gaps) * scale + gaps;
+        Vector2 textPos = { layout->centerX - textWidth / 2.0f, layout->menu.optionsY + i * 30.0f };
         Color color = (i == selectedOption) ? YELLOW : WHITE;
 
         // Draw glow effect for selected option
@@ -543,88 +583,55 @@ void render_menu(int screenWidth, int screenHeight, Font font, int selectedOptio
     }
 
     // Draw title
-    Vector2 titleSize = MeasureTextEx(font, "Pac-Man", 20.0f, 1);
-    DrawTextEx(font, "Pac-Man", (Vector2){screenWidth / 2.0f - titleSize.x / 2.0f, screenHeight / 2.0f - 100.0f}, 20.0f, 1, YELLOW);
+    DrawTextEx(font, "Pac-Man", layout->menu.title, 20.0f, 1, YELLOW);
 
     // Draw navigation instructions
-    Vector2 navSize = MeasureTextEx(font, "Use UP/DOWN to select, ENTER to confirm", 10.0f, 1);
-    DrawTextEx(font, "Use UP/DOWN to select, ENTER to confirm", 
-               (Vector2){screenWidth / 2.0f - navSize.x / 2.0f, screenHeight / 2.0f + 110.0f}, 10.0f, 1, GRAY);
-
-    // Draw CRT scanlines
-    for (int y = 0; y < screenHeight; y += 4) {
-        DrawRectangle(0, y, screenWidth, 2, Fade(BLACK, 0.2f));
-    }
+    DrawTextEx(font, "Use UP/DOWN to select, ENTER to confirm", layout->menu.hint, 10.0f, 1, GRAY);
 }
 
 // Renders the high scores screen (STATE_HIGHSCORES) with the top scores.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_highscores(int screenWidth, int screenHeight, Font font) {
+void render_highscores(const ScreenLayout *layout, Font font) {
     ClearBackground(BLACK);
-    Vector2 titleSize = MeasureTextEx(font, "High Scores", 20.0f, 1);
-    DrawTextEx(font, "High Scores", (Vector2){screenWidth / 2 - titleSize.x / 2, screenHeight / 2 - 100}, 20.0f, 1, YELLOW);
+    DrawTextEx(font, "High Scores", layout->highscores.title, 20.0f, 1, YELLOW);
     for (int i = 0; i < MAX_HIGH_SCORES; i++) {
-        char scoreText[32];
-        sprintf(scoreText, "%d. %s - %d", i + 1, highscores[i].name, highscores[i].score);
-        Vector2 scoreSize = MeasureTextEx(font, scoreText, 16.0f, 1);
-        DrawTextEx(font, scoreText, (Vector2){screenWidth / 2 - scoreSize.x / 2, screenHeight / 2 - 60 + i * 20}, 16.0f, 1, WHITE);
+        const char *scoreText = FormatTextLabel(&highscoreLabels[i], (int[TEXT_LABEL_KEYS]){ highscoresVersion },
+                                                "%d. %s - %d", i + 1, highscores[i].name, highscores[i].score);
+        Vector2 scoreSize = MeasureTextLabel(&highscoreLabels[i], font, 16.0f, 1);
+        DrawTextEx(font, scoreText, (Vector2){layout->centerX - scoreSize.x / 2, layout->highscores.rowsY + i * 20}, 16.0f, 1, WHITE);
     }
-    Vector2 returnSize = MeasureTextEx(font, "Press ENTER or ESC to return", 10.0f, 1);
-    DrawTextEx(font, "Press ENTER or ESC to return", (Vector2){screenWidth / 2 - returnSize.x / 2, screenHeight / 2 + 100}, 10.0f, 1, GRAY);
+    DrawTextEx(font, "Press ENTER or ESC to return", layout->highscores.hint, 10.0f, 1, GRAY);
 }
 
 // Renders the about screen (STATE_ABOUT) with game information.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_about(int screenWidth, int screenHeight, Font font) {
+void render_about(const ScreenLayout *layout, Font font) {
     ClearBackground(BLACK);
-    Vector2 titleSize = MeasureTextEx(font, "About Pac-Man Remake", 20.0f, 1);
-    DrawTextEx(font, "About Pac-Man Remake", (Vector2){screenWidth / 2 - titleSize.x / 2, screenHeight / 2 - 100}, 20.0f, 1, YELLOW);
-    Vector2 devSize = MeasureTextEx(font, "Developed by Kyle Gregory Ibo", 16.0f, 1);
-    DrawTextEx(font, "Developed by Kyle Gregory Ibo", (Vector2){screenWidth / 2 - devSize.x / 2, screenHeight / 2 - 40}, 16.0f, 1, WHITE);
-    Vector2 raylibSize = MeasureTextEx(font, "Powered by Raylib", 16.0f, 1);
-    DrawTextEx(font, "Powered by Raylib", (Vector2){screenWidth / 2 - raylibSize.x / 2, screenHeight / 2 - 10}, 16.0f, 1, WHITE);
-    Vector2 versionSize = MeasureTextEx(font, "Version 1.0", 16.0f, 1);
-    DrawTextEx(font, "Version 1.0", (Vector2){screenWidth / 2 - versionSize.x / 2, screenHeight / 2 + 20}, 16.0f, 1, WHITE);
-    Vector2 returnSize = MeasureTextEx(font, "Press ENTER or ESC to return", 10.0f, 1);
-    DrawTextEx(font, "Press ENTER or ESC to return", (Vector2){screenWidth / 2 - returnSize.x / 2, screenHeight / 2 + 80}, 10.0f, 1, GRAY);
+    DrawTextEx(font, "About Pac-Man Remake", layout->about[0], 20.0f, 1, YELLOW);
+    DrawTextEx(font, "Developed by Kyle Gregory Ibo", layout->about[1], 16.0f, 1, WHITE);
+    DrawTextEx(font, "Powered by Raylib", layout->about[2], 16.0f, 1, WHITE);
+    DrawTextEx(font, "Version 1.0", layout->about[3], 16.0f, 1, WHITE);
+    DrawTextEx(font, "Press ENTER or ESC to return", layout->about[4], 10.0f, 1, GRAY);
 }
 
-// Renders the settings menu (STATE_SETTINGS) with volume sliders and mute toggle.
-// Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
-//   font - Font used for rendering text.
-//   selectedOption - Currently selected settings option.
-void render_settings_menu(int screenWidth, int screenHeight, Font font, int selectedOption) {
+// Draws the settings rows (labels, volume sliders and the mute state) at their cached positions.
+static void draw_settings_options(const ScreenLayout *layout, Font font, int selectedOption) {
     const char *options[] = {"BG MUSIC VOLUME", "SFX VOLUME", "MUTE"}; // Updated to "SFX VOLUME" for all sound effects
-    int numOptions = 3;
     int fontSize = 16;
-    int spacing = 30;
-    int startY = screenHeight / 2 - (numOptions * spacing) / 2;
     int sliderWidth = fontSize * 6;
     int sliderHeight = (int)(fontSize * 0.3 + 0.5);
+    float sliderX = layout->settings.sliderX;
 
-    // Draw "SETTINGS" title
-    const char *title = "SETTINGS";
-    Vector2 titleSize = MeasureTextEx(font, title, fontSize * 1.25, 2);
-    DrawTextEx(font, title, (Vector2){screenWidth / 2 - titleSize.x / 2, startY - 60}, fontSize * 1.5, 2, YELLOW);
-
-    // Draw settings options
-    for (int i = 0; i < numOptions; i++) {
+    for (int i = 0; i < LAYOUT_SETTINGS_OPTIONS; i++) {
         Color color = (i == selectedOption) ? YELLOW : WHITE;
-        Vector2 textSize = MeasureTextEx(font, options[i], fontSize, 2);
-        float textX = screenWidth / 2 - textSize.x - 30;
-        float sliderX = screenWidth / 2 + 10;
-        float y = startY + i * spacing;
+        float y = layout->settings.labels[i].y;
 
         // Draw option text
-        DrawTextEx(font, options[i], (Vector2){textX, y}, fontSize, 2, color);
+        DrawTextEx(font, options[i], layout->settings.labels[i], fontSize, 2, color);
 
         // Draw sliders or mute status
         if (i < 2) {
@@ -634,108 +641,72 @@ void render_settings_menu(int screenWidth, int screenHeight, Font font, int sele
             DrawRectangle(sliderX, y + 2, sliderWidth * volume, sliderHeight, color);
             char valueText[16];
             sprintf(valueText, "%.0f%%", volume * 100);
-            Vector2 valueSize = MeasureTextEx(font, valueText, fontSize * 0.8, 2);
             DrawTextEx(font, valueText, (Vector2){sliderX + sliderWidth + 10, y}, fontSize * 0.8, 2, WHITE);
         } else {
             // Mute toggle
             const char *muteText = soundMuted ? "ON" : "OFF";
-            Vector2 muteSize = MeasureTextEx(font, muteText, fontSize, 2);
             DrawTextEx(font, muteText, (Vector2){sliderX, y}, fontSize, 2, color);
         }
     }
 }
 
+// Renders the settings menu (STATE_SETTINGS) with volume sliders and mute toggle.
+// Parameters:
+//   layout - Screen layout.
+//   font - Font used for rendering text.
+//   selectedOption - Currently selected settings option.
+void render_settings_menu(const ScreenLayout *layout, Font font, int selectedOption) {
+    // Draw "SETTINGS" title
+    DrawTextEx(font, "SETTINGS", layout->settings.title, 24.0f, 2, YELLOW);
+
+    // Draw settings options
+    draw_settings_options(layout, font, selectedOption);
+}
+
 // Renders the pause menu (STATE_PAUSED) with options to resume, restart, adjust settings, or quit.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
-void render_pause_menu(int screenWidth, int screenHeight, Font font) {
+void render_pause_menu(const ScreenLayout *layout, Font font) {
     // Draw a semi-transparent overlay
-    DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.5f));
+    DrawRectangle(0, 0, layout->canvasWidth, layout->canvasHeight, Fade(BLACK, 0.5f));
 
     if (pauseMenuState == PAUSE_MENU_MAIN) {
         const char *options[] = {"RESUME", "RESTART", "SETTINGS", "QUIT"};
-        int numOptions = 4;
         int fontSize = 16;
-        int spacing = 30;
-        int startY = screenHeight / 2 - (numOptions * spacing) / 2;
 
         // Draw "PAUSED" title
-        const char *title = "PAUSED";
-        Vector2 titleSize = MeasureTextEx(font, title, fontSize * 1.25, 2);
-        DrawTextEx(font, title, (Vector2){screenWidth / 2 - titleSize.x / 2, startY - 60}, fontSize * 1.25, 2, YELLOW);
+        DrawTextEx(font, "PAUSED", layout->pause.title, fontSize * 1.25, 2, YELLOW);
 
         // Draw menu options
-        for (int i = 0; i < numOptions; i++) {
+        for (int i = 0; i < LAYOUT_PAUSE_OPTIONS; i++) {
             Color color = (i == pauseSelectedOption) ? YELLOW : WHITE;
-            Vector2 textSize = MeasureTextEx(font, options[i], fontSize, 2);
-            DrawTextEx(font, options[i], (Vector2){screenWidth / 2 - textSize.x / 2, startY + i * spacing}, fontSize, 2, color);
+            DrawTextEx(font, options[i], layout->pause.options[i], fontSize, 2, color);
         }
     } else if (pauseMenuState == PAUSE_MENU_SETTINGS) {
-        const char *options[] = {"BG MUSIC VOLUME", "SFX VOLUME", "MUTE"}; // Updated to "SFX VOLUME" for all sound effects
-        int numOptions = 3;
-        int fontSize = 16;
-        int spacing = 30;
-        int startY = screenHeight / 2 - (numOptions * spacing) / 2;
-        int sliderWidth = fontSize * 6;
-        int sliderHeight = (int)(fontSize * 0.3 + 0.5);
-
         // Draw "SETTINGS" title
-        const char *title = "PAUSE MENU - SETTINGS";
-        Vector2 titleSize = MeasureTextEx(font, title, fontSize * 1.25, 2);
-        DrawTextEx(font, title, (Vector2){screenWidth / 2 - titleSize.x / 2, startY - 60}, fontSize * 1.5, 2, YELLOW);
+        DrawTextEx(font, "PAUSE MENU - SETTINGS", layout->settings.pauseTitle, 24.0f, 2, YELLOW);
 
         // Draw settings options
-        for (int i = 0; i < numOptions; i++) {
-            Color color = (i == pauseSelectedOption) ? YELLOW : WHITE;
-            Vector2 textSize = MeasureTextEx(font, options[i], fontSize, 2);
-            float textX = screenWidth / 2 - textSize.x - 30;
-            float sliderX = screenWidth / 2 + 10;
-            float y = startY + i * spacing;
-
-            // Draw option text
-            DrawTextEx(font, options[i], (Vector2){textX, y}, fontSize, 2, color);
-
-            // Draw sliders or mute status
-            if (i < 2) {
-                // Sliders for volumes
-                float volume = (i == 0) ? bgMusicVolume : sfxVolume;
-                DrawRectangle(sliderX, y + 2, sliderWidth, sliderHeight, GRAY);
-                DrawRectangle(sliderX, y + 2, sliderWidth * volume, sliderHeight, color);
-                char valueText[16];
-                sprintf(valueText, "%.0f%%", volume * 100);
-                Vector2 valueSize = MeasureTextEx(font, valueText, fontSize * 0.8, 2);
-                DrawTextEx(font, valueText, (Vector2){sliderX + sliderWidth + 10, y}, fontSize * 0.8, 2, WHITE);
-            } else {
-                // Mute toggle
-                const char *muteText = soundMuted ? "ON" : "OFF";
-                Vector2 muteSize = MeasureTextEx(font, muteText, fontSize, 2);
-                DrawTextEx(font, muteText, (Vector2){sliderX, y}, fontSize, 2, color);
-            }
-        }
+        draw_settings_options(layout, font, pauseSelectedOption);
 
         // Draw navigation instructions
-        DrawTextEx(font, "Press ENTER to return to Pause Menu", 
-                   (Vector2){screenWidth / 2 - 120, startY + numOptions * spacing + 20}, 10.0f, 1, GRAY);
+        DrawTextEx(font, "Press ENTER to return to Pause Menu", layout->settings.pauseHint, 10.0f, 1, GRAY);
     }
 }
 
-void render_level_complete(int screenWidth, int screenHeight, Font font, float animTimer, int currentLevel,
+void render_level_complete(const ScreenLayout *layout, Font font, float animTimer, int currentLevel,
                            int eatenPellets, int eatenPowerPellets, int eatenGhosts,
                            int collectedFruits, int fruitPoints) {
     // Static "Level Complete!" text
-    const char* levelCompleteText = "Level Complete!";
-    Vector2 textSize = MeasureTextEx(font, levelCompleteText, 20.0f, 1);
-    Vector2 textPos = { screenWidth / 2.0f - textSize.x / 2.0f, screenHeight / 2.0f - 80 };
-    DrawTextEx(font, levelCompleteText, textPos, 20.0f, 1, YELLOW);
+    DrawTextEx(font, "Level Complete!", layout->levelComplete.title, 20.0f, 1, YELLOW);
 
     // Fading "Preparing Level X..." subtitle
     float subtitleAlpha = (animTimer < 4.0f) ? (1.0f - animTimer / 4.0f) : 0.0f;
-    char subtitle[32];
-    snprintf(subtitle, sizeof(subtitle), "Preparing Level %d...", currentLevel);
-    textSize = MeasureTextEx(font, subtitle, 16.0f, 1);
-    textPos = (Vector2){ screenWidth / 2.0f - textSize.x / 2.0f, screenHeight / 2.0f - 40 };
+    const char *subtitle = FormatTextLabel(&levelSubtitleLabel, (int[TEXT_LABEL_KEYS]){ currentLevel },
+                                           "Preparing Level %d...", currentLevel);
+    Vector2 textSize = MeasureTextLabel(&levelSubtitleLabel, font, 16.0f, 1);
+    Vector2 textPos = { layout->centerX - textSize.x / 2.0f, layout->levelComplete.subtitleY };
     DrawTextEx(font, subtitle, textPos, 16.0f, 1, Fade(WHITE, subtitleAlpha));
 
     // Score breakdown with sequential fade-in
@@ -782,19 +753,19 @@ void render_level_complete(int screenWidth, int screenHeight, Font font, float a
     int fruitScore = collectedFruits * fruitPoints;
 
     // Measure text widths for score breakdown
-    char pelletsText[32];
-    char powerPelletsText[32];
-    char ghostsText[32];
-    char fruitsText[32];
-    snprintf(pelletsText, sizeof(pelletsText), "Pellets: %d x 10 = %d", eatenPellets, pelletsScore);
-    snprintf(powerPelletsText, sizeof(powerPelletsText), "Power Pellets: %d x 50 = %d", eatenPowerPellets, powerPelletsScore);
-    snprintf(ghostsText, sizeof(ghostsText), "Ghosts Eaten: %d = %d", eatenGhosts, ghostPoints);
-    snprintf(fruitsText, sizeof(fruitsText), "Fruits: %d x %d = %d", collectedFruits, fruitPoints, fruitScore);
-
-    Vector2 pelletsSize = MeasureTextEx(font, pelletsText, 10.0f, 1);
-    Vector2 powerPelletsSize = MeasureTextEx(font, powerPelletsText, 10.0f, 1);
-    Vector2 ghostsSize = MeasureTextEx(font, ghostsText, 10.0f, 1);
-    Vector2 fruitsSize = MeasureTextEx(font, fruitsText, 10.0f, 1);
+    const char *pelletsText = FormatTextLabel(&levelBreakdownLabels[0], (int[TEXT_LABEL_KEYS]){ eatenPellets },
+                                              "Pellets: %d x 10 = %d", eatenPellets, pelletsScore);
+    const char *powerPelletsText = FormatTextLabel(&levelBreakdownLabels[1], (int[TEXT_LABEL_KEYS]){ eatenPowerPellets },
+                                                   "Power Pellets: %d x 50 = %d", eatenPowerPellets, powerPelletsScore);
+    const char *ghostsText = FormatTextLabel(&levelBreakdownLabels[2], (int[TEXT_LABEL_KEYS]){ eatenGhosts },
+                                             "Ghosts Eaten: %d = %d", eatenGhosts, ghostPoints);
+    const char *fruitsText = FormatTextLabel(&levelBreakdownLabels[3], (int[TEXT_LABEL_KEYS]){ collectedFruits, fruitPoints },
+                                             "Fruits: %d x %d = %d", collectedFruits, fruitPoints, fruitScore);
+
+    Vector2 pelletsSize = MeasureTextLabel(&levelBreakdownLabels[0], font, 10.0f, 1);
+    Vector2 powerPelletsSize = MeasureTextLabel(&levelBreakdownLabels[1], font, 10.0f, 1);
+    Vector2 ghostsSize = MeasureTextLabel(&levelBreakdownLabels[2], font, 10.0f, 1);
+    Vector2 fruitsSize = MeasureTextLabel(&levelBreakdownLabels[3], font, 10.0f, 1);
 
     // Calculate maximum text width
     float maxTextWidth = pelletsSize.x;
@@ -804,8 +775,8 @@ void render_level_complete(int screenWidth, int screenHeight, Font font, float a
 
     // Draw semi-transparent background for score breakdown and progress bar
     Rectangle backgroundRect = {
-        screenWidth / 2.0f - (maxTextWidth / 2.0f + 20), // x: centered, max text width + 20 padding
-        screenHeight / 2.0f - 10,                        // y: start 10 pixels above pellets text
+        layout->centerX - (maxTextWidth / 2.0f + 20),    // x: centered, max text width + 20 padding
+        layout->levelComplete.panelY,                    // y: start 10 pixels above pellets text
         maxTextWidth + 40,                               // width: max text width + 20 padding on each side
         130                                              // height: 60 (text height) + 10 (gap) + 10 (bar height) + 30 padding
     };
@@ -814,19 +785,19 @@ void render_level_complete(int screenWidth, int screenHeight, Font font, float a
     // Score breakdown with centered text
     float leftPadding = backgroundRect.x + 20; // 20 pixels padding from left edge
     DrawTextEx(font, pelletsText,
-               (Vector2){ leftPadding, screenHeight / 2.0f + 0 }, 10.0f, 1, Fade(WHITE, pelletsAlpha));
+               (Vector2){ leftPadding, layout->levelComplete.breakdownY }, 10.0f, 1, Fade(WHITE, pelletsAlpha));
     DrawTextEx(font, powerPelletsText,
-               (Vector2){ leftPadding, screenHeight / 2.0f + 20 }, 10.0f, 1, Fade(WHITE, powerPelletsAlpha));
+               (Vector2){ leftPadding, layout->levelComplete.breakdownY + 20 }, 10.0f, 1, Fade(WHITE, powerPelletsAlpha));
     DrawTextEx(font, ghostsText,
-               (Vector2){ leftPadding, screenHeight / 2.0f + 40 }, 10.0f, 1, Fade(WHITE, ghostsAlpha));
+               (Vector2){ leftPadding, layout->levelComplete.breakdownY + 40 }, 10.0f, 1, Fade(WHITE, ghostsAlpha));
     DrawTextEx(font, fruitsText,
-               (Vector2){ leftPadding, screenHeight / 2.0f + 60 }, 10.0f, 1, Fade(WHITE, fruitsAlpha));
+               (Vector2){ leftPadding, layout->levelComplete.breakdownY + 60 }, 10.0f, 1, Fade(WHITE, fruitsAlpha));
 
     // Progress bar for remaining time
     float progress = animTimer / 3.5f;  // Adjusted to fill over 3.5 seconds
     float barWidth = maxTextWidth;      // Match bar width to text width
     float barHeight = 10.0f;
-    Rectangle barOutline = { screenWidth / 2.0f - barWidth / 2.0f, screenHeight / 2.0f + 100, barWidth, barHeight };
+    Rectangle barOutline = { layout->centerX - barWidth / 2.0f, layout->levelComplete.barY, barWidth, barHeight };
     Rectangle barFill = { barOutline.x, barOutline.y, barWidth * progress, barHeight };
     DrawRectangleRec(barOutline, Fade(WHITE, progressBarAlpha * 0.5f)); // Outline with half opacity
     DrawRectangleRec(barFill, Fade(YELLOW, progressBarAlpha));
@@ -834,40 +805,34 @@ void render_level_complete(int screenWidth, int screenHeight, Font font, float a
 
 // Renders the game over screen (STATE_GAME_OVER), including name input and high scores.
 // Parameters:
-//   screenWidth - Width of the screen in pixels.
-//   screenHeight - Height of the screen in pixels.
+//   layout - Screen layout.
 //   font - Font used for rendering text.
 //   gameOverFadeAlpha - Alpha value for fade-in/out effects.
-void render_game_over(int screenWidth, int screenHeight, Font font, float gameOverFadeAlpha) {
+void render_game_over(const ScreenLayout *layout, Font font, float gameOverFadeAlpha) {
     ClearBackground(BLACK);
 
     // Declare variables once to avoid shadowing
-    char scoreText[32];
+    const char *scoreText;
     Vector2 scoreSize;
 
     // Game Over text
-    Vector2 gameOverSize = MeasureTextEx(font, "Game Over", 24.0f, 1);
-    DrawTextEx(font, "Game Over",
-            (Vector2){screenWidth / 2 - gameOverSize.x / 2, screenHeight / 2 - 150},
-            24.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
+    const GameOverLayout *gameOver = &layout->gameOver;
+    DrawTextEx(font, "Game Over", gameOver->title, 24.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
 
     // Score and motivational message
-    sprintf(scoreText, "Final Score: %d", pacman.score);
-    scoreSize = MeasureTextEx(font, scoreText, 16.0f, 1);
+    scoreText = FormatTextLabel(&finalScoreLabel, (int[TEXT_LABEL_KEYS]){ pacman.score }, "Final Score: %d", pacman.score);
+    scoreSize = MeasureTextLabel(&finalScoreLabel, font, 16.0f, 1);
     DrawTextEx(font, scoreText,
-            (Vector2){screenWidth / 2 - scoreSize.x / 2, screenHeight / 2 - 90},
+            (Vector2){layout->centerX - scoreSize.x / 2, gameOver->finalScoreY},
             16.0f, 1, Fade(WHITE, gameOverFadeAlpha));
-    Vector2 messageSize = MeasureTextEx(font, gameOverMessages[selectedMessageIndex], 12.0f, 1);
+    Vector2 messageSize = MeasureTextCached(font, gameOverMessages[selectedMessageIndex], 12.0f, 1);
     DrawTextEx(font, gameOverMessages[selectedMessageIndex],
-            (Vector2){screenWidth / 2 - messageSize.x / 2, screenHeight / 2 - 60},
+            (Vector2){layout->centerX - messageSize.x / 2, gameOver->messageY},
             12.0f, 1, Fade(WHITE, gameOverFadeAlpha));
 
     // Add delay and fade-in for name input
     if (!nameInputComplete) {
-        Vector2 initialsLabelSize = MeasureTextEx(font, "Enter Initials:", 16.0f, 1);
-        DrawTextEx(font, "Enter Initials:",
-                (Vector2){screenWidth / 2 - initialsLabelSize.x / 2, screenHeight / 2 - 30},
-                16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
+        DrawTextEx(font, "Enter Initials:", gameOver->enterInitialsLabel, 16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
         char displayName[4] = {'_', '_', '_', '\0'};
         for (int i = 0; i < nameInputIndex; i++) {
             displayName[i] = playerNameInput[i];
@@ -876,64 +841,50 @@ void render_game_over(int screenWidth, int screenHeight, Font font, float gameOv
         if (((int)(GetTime() * 2.0f) % 2) == 0 && nameInputIndex < 3) {
             displayName[nameInputIndex] = '|';
         }
-        Vector2 displayNameSize = MeasureTextEx(font, displayName, 16.0f, 1);
+        Vector2 displayNameSize = MeasureTextCached(font, displayName, 16.0f, 1);
         DrawTextEx(font, displayName,
-                (Vector2){screenWidth / 2 - displayNameSize.x / 2, screenHeight / 2},
+                (Vector2){layout->centerX - displayNameSize.x / 2, gameOver->nameY},
                 16.0f, 1, Fade(WHITE, gameOverFadeAlpha));
-        Vector2 confirmSize = MeasureTextEx(font, "Press ENTER to confirm", 10.0f, 1);
-        DrawTextEx(font, "Press ENTER to confirm",
-                (Vector2){screenWidth / 2 - confirmSize.x / 2, screenHeight / 2 + 30},
-                10.0f, 1, Fade(GRAY, gameOverFadeAlpha));
+        DrawTextEx(font, "Press ENTER to confirm", gameOver->confirmHint, 10.0f, 1, Fade(GRAY, gameOverFadeAlpha));
 
         // High score preview with placeholder
-        DrawRectangleLines(screenWidth / 2 - 90, screenHeight / 2 + 50, 180, 130, Fade(YELLOW, gameOverFadeAlpha));
-        Vector2 highScoresLabelSize = MeasureTextEx(font, "High Scores:", 16.0f, 1);
-        DrawTextEx(font, "High Scores:",
-                (Vector2){screenWidth / 2 - highScoresLabelSize.x / 2, screenHeight / 2 + 60},
-                16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
+        DrawRectangleLines((int)gameOver->inputScoreBox.x, (int)gameOver->inputScoreBox.y, (int)gameOver->inputScoreBox.width, (int)gameOver->inputScoreBox.height,
+                           Fade(YELLOW, gameOverFadeAlpha));
+        DrawTextEx(font, "High Scores:", gameOver->highScoresLabel, 16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
         for (int i = 0; i < MAX_HIGH_SCORES; i++) {
             char* scoreDisplayName = (i == 0 && pacman.score > highscores[i].score) ? "YOU" : highscores[i].name;
             int displayScore = (i == 0 && pacman.score > highscores[i].score) ? pacman.score : highscores[i].score;
-            sprintf(scoreText, "%s: %d", scoreDisplayName, displayScore);
-            scoreSize = MeasureTextEx(font, scoreText, 12.0f, 1);
+            scoreText = FormatTextLabel(&gameOverScoreLabels[i], (int[TEXT_LABEL_KEYS]){ highscoresVersion, pacman.score },
+                                        "%s: %d", scoreDisplayName, displayScore);
+            scoreSize = MeasureTextLabel(&gameOverScoreLabels[i], font, 12.0f, 1);
             DrawTextEx(font, scoreText,
-                    (Vector2){screenWidth / 2 - scoreSize.x / 2, screenHeight / 2 + 80 + i * 20},
+                    (Vector2){layout->centerX - scoreSize.x / 2, gameOver->scoreRowsY + i * 20},
                     12.0f, 1, Fade((i == 0 && pacman.score > highscores[i].score) ? GREEN : WHITE, gameOverFadeAlpha));
         }
     } else {
-        Vector2 initialsLabelSize = MeasureTextEx(font, "Initials:", 16.0f, 1);
-        DrawTextEx(font, "Initials:",
-                (Vector2){screenWidth / 2 - initialsLabelSize.x / 2, screenHeight / 2 - 30},
-                16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
-        Vector2 playerNameSize = MeasureTextEx(font, playerNameInput, 16.0f, 1);
+        DrawTextEx(font, "Initials:", gameOver->initialsLabel, 16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
+        Vector2 playerNameSize = MeasureTextCached(font, playerNameInput, 16.0f, 1);
         DrawTextEx(font, playerNameInput,
-                (Vector2){screenWidth / 2 - playerNameSize.x / 2, screenHeight / 2},
+                (Vector2){layout->centerX - playerNameSize.x / 2, gameOver->nameY},
                 16.0f, 1, Fade(WHITE, gameOverFadeAlpha));
         // High score list with retro border
-        DrawRectangleLines(screenWidth / 2 - 80, screenHeight / 2 + 50, 160, 120, Fade(YELLOW, gameOverFadeAlpha));
-        Vector2 highScoresLabelSize = MeasureTextEx(font, "High Scores:", 16.0f, 1);
-        DrawTextEx(font, "High Scores:",
-                (Vector2){screenWidth / 2 - highScoresLabelSize.x / 2, screenHeight / 2 + 60},
-                16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
+        DrawRectangleLines((int)gameOver->scoreBox.x, (int)gameOver->scoreBox.y, (int)gameOver->scoreBox.width, (int)gameOver->scoreBox.height,
+                           Fade(YELLOW, gameOverFadeAlpha));
+        DrawTextEx(font, "High Scores:", gameOver->highScoresLabel, 16.0f, 1, Fade(YELLOW, gameOverFadeAlpha));
         for (int i = 0; i < MAX_HIGH_SCORES; i++) {
             bool isPlayerScore = (strcmp(highscores[i].name, playerNameInput) == 0 && highscores[i].score == pacman.score);
-            sprintf(scoreText, "%s: %d", highscores[i].name, highscores[i].score);
-            scoreSize = MeasureTextEx(font, scoreText, 12.0f, 1);
+            scoreText = FormatTextLabel(&gameOverScoreLabels[i], (int[TEXT_LABEL_KEYS]){ highscoresVersion, -1 },
+                                        "%s: %d", highscores[i].name, highscores[i].score);
+            scoreSize = MeasureTextLabel(&gameOverScoreLabels[i], font, 12.0f, 1);
             DrawTextEx(font, scoreText,
-                    (Vector2){screenWidth / 2 - scoreSize.x / 2, screenHeight / 2 + 80 + i * 20},
+                    (Vector2){layout->centerX - scoreSize.x / 2, gameOver->scoreRowsY + i * 20},
                     12.0f, 1, Fade(isPlayerScore ? GREEN : WHITE, gameOverFadeAlpha));
         }
-        Vector2 returnSize = MeasureTextEx(font, "Press ENTER to Return to Menu", 10.0f, 1);
-        DrawTextEx(font, "Press ENTER to Return to Menu",
-                (Vector2){screenWidth / 2 - returnSize.x / 2, screenHeight / 2 + 180},
-                10.0f, 1, Fade(GRAY, gameOverFadeAlpha));
+        DrawTextEx(font, "Press ENTER to Return to Menu", gameOver->returnHint, 10.0f, 1, Fade(GRAY, gameOverFadeAlpha));
     }
 
     // Error message for failed high score saving
     if (saveHighScoreFailed) {
-        Vector2 errorSize = MeasureTextEx(font, "Failed to save high score!", 12.0f, 1);
-        DrawTextEx(font, "Failed to save high score!",
-                (Vector2){screenWidth / 2 - errorSize.x / 2, screenHeight / 2 + 210},
-                12.0f, 1, Fade(RED, gameOverFadeAlpha));
+        DrawTextEx(font, "Failed to save high score!", gameOver->saveError, 12.0f, 1, Fade(RED, gameOverFadeAlpha));
     }
 }
\ No newline at end of file
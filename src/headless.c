@@ -0,0 +1,154 @@
+#include "headless.h"
+#include "game_logic.h"
+#include "render_commands.h"
+#include "rendering.h"
+#include "soft_render.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HEADLESS_TICK_TIME (1.0f / 60.0f)
+
+typedef struct {
+    int ticks;
+    int every;
+    const char *outDir;
+    const char *format;
+    unsigned int seed;
+    RenderBackend backend;      // RENDER_BACKEND_SOFTWARE writes frames, RENDER_BACKEND_NULL only builds them
+} HeadlessOptions;
+
+static bool parse_options(int argc, char *argv[], HeadlessOptions *options) {
+    *options = (HeadlessOptions){ 3600, 60, "frames", "png", 1, RENDER_BACKEND_SOFTWARE };
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--headless") == 0) {
+            continue;
+        } else if (strcmp(arg, "--ticks") == 0 && hasValue) {
+            options->ticks = atoi(argv[++i]);
+        } else if (strcmp(arg, "--every") == 0 && hasValue) {
+            options->every = atoi(argv[++i]);
+        } else if (strcmp(arg, "--out") == 0 && hasValue) {
+            options->outDir = argv[++i];
+        } else if (strcmp(arg, "--format") == 0 && hasValue) {
+            options->format = argv[++i];
+        } else if (strcmp(arg, "--seed") == 0 && hasValue) {
+            options->seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--backend") == 0 && hasValue) {
+            const char *name = argv[++i];
+            if (strcmp(name, "software") == 0) {
+                options->backend = RENDER_BACKEND_SOFTWARE;
+            } else if (strcmp(name, "null") == 0) {
+                options->backend = RENDER_BACKEND_NULL;
+            } else {
+                fprintf(stderr, "headless: --backend must be software or null\n");
+                return false;
+            }
+        } else {
+            fprintf(stderr, "headless: unknown or incomplete option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options->every <= 0 || options->ticks < 0 ||
+        (strcmp(options->format, "png") != 0 && strcmp(options->format, "ppm") != 0)) {
+        fprintf(stderr, "headless: --every must be positive, --ticks not negative, --format png or ppm\n");
+        return false;
+    }
+    return true;
+}
+
+// One simulation tick. Fades do not exist here, so what main.c does once a fade ends happens at once.
+static void headless_tick(void) {
+    simDeltaTime = HEADLESS_TICK_TIME;
+    if (gameState == STATE_PLAYING) {
+        steer_autopilot();
+    }
+
+    switch (step_gameplay()) {
+        case GAMEPLAY_GAME_OVER:
+            gameState = STATE_GAME_OVER;
+            break;
+        case GAMEPLAY_NEXT_LEVEL:
+            init_maze();
+            break;
+        default:
+            break;
+    }
+
+    clear_tile_journal();
+}
+
+// Headless Mode
+// ----------------------------------------------------------------------------------------
+bool is_headless_run(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--headless") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int run_headless(int argc, char *argv[]) {
+    HeadlessOptions options;
+    if (!parse_options(argc, argv, &options)) {
+        return EXIT_FAILURE;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(options.seed);
+    simRandomState = options.seed;
+    bool writeFrames = options.backend == RENDER_BACKEND_SOFTWARE;
+    if (writeFrames && !InitSoftRenderer()) {
+        return EXIT_FAILURE;
+    }
+    if (writeFrames && !DirectoryExists(options.outDir) && MakeDirectory(options.outDir) != 0) {
+        fprintf(stderr, "headless: cannot create %s\n", options.outDir);
+        UnloadSoftRenderer();
+        return EXIT_FAILURE;
+    }
+
+    // Same layout as the windowed game
+    const GameplayLayout layout = compute_gameplay_layout(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    start_new_game();
+
+    clock_t start = clock();
+    int framesWritten = 0;
+    int tick = 0;
+    for (; tick < options.ticks && gameState != STATE_GAME_OVER; tick++) {
+        headless_tick();
+
+        if ((tick + 1) % options.every == 0) {
+            // The gameplay screen as in main.c, minus the text (the CPU renderer has no glyphs)
+            BeginRenderCommands();
+            PushClearCommand(BLACK);
+            render_gameplay(&layout);
+            SubmitRenderCommands(options.backend);
+            if (!writeFrames) {
+                continue;
+            }
+
+            const char *fileName = TextFormat("%s/frame_%06d.%s", options.outDir, tick + 1, options.format);
+            if (!ExportSoftFrame(fileName)) {
+                fprintf(stderr, "headless: cannot write %s\n", fileName);
+                UnloadSoftRenderer();
+                return EXIT_FAILURE;
+            }
+            framesWritten ++;
+        }
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("headless: %d ticks (%.1f s of play) in %.2f s, %d frames written to %s, score %d, level %d\n",
+           tick, tick * HEADLESS_TICK_TIME, seconds, framesWritten, options.outDir, pacman.score, level);
+
+    if (writeFrames) {
+        UnloadSoftRenderer();
+    }
+    return EXIT_SUCCESS;
+}
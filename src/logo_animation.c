@@ -1,4 +1,5 @@
 #include "logo_animation.h"
+#include "sprite_frames.h"
 
 // Static text for personal logo
 static const char* personalText[] = {
@@ -86,8 +87,8 @@ bool update_personal_logo(LogoAnimation* anim) {
     anim->spriteVelocity += 300.0f * GetFrameTime(); // Gravity
     anim->spriteY += anim->spriteVelocity * GetFrameTime();
     // Bounce when hitting bottom boundary
-    if (anim->spriteY > GetScreenHeight() / 2.0f - 20.0f) {
-        anim->spriteY = GetScreenHeight() / 2.0f - 20.0f;
+    if (anim->spriteY > SCREEN_HEIGHT / 2.0f - 20.0f) {
+        anim->spriteY = SCREEN_HEIGHT / 2.0f - 20.0f;
         anim->spriteVelocity = -150.0f; // Bounce upward
     }
 
@@ -140,11 +141,6 @@ void render_personal_logo(const LogoAnimation* anim, int screenWidth, int screen
     int kgiWidth = MeasureTextEx(font, kgiText, kgiFontSize, 1).x;
     Vector2 kgiPos = { screenWidth / 2.0f - kgiWidth / 2.0f, anim->spriteY };
     DrawTextEx(font, kgiText, kgiPos, kgiFontSize, 1, Fade(YELLOW, anim->personalAlpha));
-
-    // Render CRT scanlines
-    for (int y = 0; y < screenHeight; y += 4) {
-        DrawRectangle(0, y, screenWidth, 2, Fade(BLACK, 0.2f * anim->personalAlpha));
-    }
 }
 
 // Raylib Logo Functions
@@ -236,8 +232,8 @@ void render_raylib_logo(const LogoAnimation* anim) {
         DrawRectangle(anim->logoPositionX, anim->logoPositionY + 16, 16, anim->leftSideRecHeight - 32, Fade(BLACK, anim->alpha));
         DrawRectangle(anim->logoPositionX + 240, anim->logoPositionY + 16, 16, anim->rightSideRecHeight - 32, Fade(BLACK, anim->alpha));
         DrawRectangle(anim->logoPositionX, anim->logoPositionY + 240, anim->bottomSideRecWidth, 16, Fade(BLACK, anim->alpha));
-        DrawRectangle(GetScreenWidth() / 2 - 112, GetScreenHeight() / 2 - 112, 224, 224, Fade(RAYWHITE, anim->alpha));
-        DrawText(TextSubtext("raylib", 0, anim->lettersCount), GetScreenWidth() / 2 - 44, GetScreenHeight() / 2 + 48, 50, Fade(BLACK, anim->alpha));
+        DrawRectangle(SCREEN_WIDTH / 2 - 112, SCREEN_HEIGHT / 2 - 112, 224, 224, Fade(RAYWHITE, anim->alpha));
+        DrawText(TextSubtext("raylib", 0, anim->lettersCount), SCREEN_WIDTH / 2 - 44, SCREEN_HEIGHT / 2 + 48, 50, Fade(BLACK, anim->alpha));
     }
 }
 
@@ -285,7 +281,7 @@ bool update_game_logo(LogoAnimation* anim) {
         anim->remakeTextAlpha = 1.0f;
         // Move Pac-Man sprite
         anim->pacmanSpriteX += 100.0f * GetFrameTime(); // Move right
-        if (anim->pacmanSpriteX > GetScreenWidth() + 32.0f) {
+        if (anim->pacmanSpriteX > SCREEN_WIDTH + 32.0f) {
             anim->pacmanSpriteX = -32.0f; // Reset to left
         }
         // Blink prompt (0.5s interval)
@@ -360,7 +356,11 @@ void render_game_logo(const LogoAnimation* anim, int screenWidth, int screenHeig
     Vector2 remakeTextPos = { screenWidth / 2 - remakeTextSize.x / 2, boxY + 80 };
     DrawTextEx(font, remakeText, remakeTextPos, remakeFontSize, 1, Fade(WHITE, anim->alphaGeneral * anim->remakeTextAlpha));
 
-    // Draw Pac-Man sprite with eating animation
+    // Draw Pac-Man sprite with eating animation. The atlas is premultiplied, so the fade scales
+    // every channel of the tint, not just its alpha
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    unsigned char spriteFade = (unsigned char)(255.0f * fmaxf(0.0f, fminf(anim->alphaGeneral, 1.0f)));
+    Color spriteTint = { spriteFade, spriteFade, spriteFade, spriteFade };
     float scaleFactor = 32.0f / 16.0f; // Scale sprite to 32x32 pixels
     static float pacmanAnimTimer = 0.0f;
     static int pacmanFrame = 0;
@@ -369,30 +369,20 @@ void render_game_logo(const LogoAnimation* anim, int screenWidth, int screenHeig
         pacmanFrame = (pacmanFrame + 1) % 3; // 3 frames: closed, half-open, fully open
         pacmanAnimTimer = 0.0f;
     }
-    float pacmanXOffset = (pacmanFrame == 0) ? 0.0f : (pacmanFrame == 1) ? 18.0f : 36.0f;
-    Rectangle pacmanSourceRec = { pacmanXOffset, 0.0f, 16.0f, 16.0f };
+    Rectangle pacmanSourceRec = SPRITE_PACMAN[DIR_RIGHT][pacmanFrame];
     Rectangle pacmanDestRec = { anim->pacmanSpriteX, boxY - 32, 32.0f, 32.0f };
     Vector2 pacmanOrigin = { 16.0f, 16.0f };
-    DrawTexturePro(pacmanSprite, pacmanSourceRec, pacmanDestRec, pacmanOrigin, 0.0f, Fade(WHITE, anim->alphaGeneral));
+    DrawTexturePro(pacmanSprite, pacmanSourceRec, pacmanDestRec, pacmanOrigin, 0.0f, spriteTint);
 
     // Draw ghost sprites trailing Pac-Man
     for (int i = 0; i < MAX_GHOSTS; i++) {
-        // Ghost sprite coordinates (Blinky: y=64, Pinky: y=80, Inky: y=96, Clyde: y=112)
-        float yOffset;
-        switch (i) {
-            case 0: yOffset = 64.0f; break; // Blinky (red)
-            case 1: yOffset = 80.0f; break; // Pinky (pink)
-            case 2: yOffset = 96.0f; break; // Inky (cyan)
-            case 3: yOffset = 112.0f; break; // Clyde (orange)
-            default: yOffset = 64.0f; break;
-        }
-        // Use right-facing sprite (x=4 or x=20 based on frame)
-        float xOffset = 4.0f + anim->ghostCurrentFrame * 16.0f;
-        Rectangle ghostSourceRec = { xOffset, yOffset, 16.0f, 16.0f };
+        // Right-facing sprite for this ghost (Blinky, Pinky, Inky, Clyde)
+        Rectangle ghostSourceRec = SPRITE_GHOST[i][DIR_RIGHT][anim->ghostCurrentFrame];
         // Position ghosts trailing Pac-Man (40px apart)
         Rectangle ghostDestRec = { anim->pacmanSpriteX - 40.0f * (i + 1), boxY - 32, 32.0f, 32.0f };
-        DrawTexturePro(ghostArray[i].normalSprite[anim->ghostCurrentFrame], ghostSourceRec, ghostDestRec, pacmanOrigin, 0.0f, Fade(WHITE, anim->alphaGeneral));
+        DrawTexturePro(ghostArray[i].normalSprite[anim->ghostCurrentFrame], ghostSourceRec, ghostDestRec, pacmanOrigin, 0.0f, spriteTint);
     }
+    EndBlendMode();
 
     // Draw prompt
     if (anim->promptVisible) {
@@ -403,11 +393,6 @@ void render_game_logo(const LogoAnimation* anim, int screenWidth, int screenHeig
         DrawTextEx(font, promptText, promptTextPos, promptFontSize, 1, Fade(WHITE, anim->alphaGeneral));
     }
 
-    // Draw CRT scanlines
-    for (int y = 0; y < screenHeight; y += 4) {
-        DrawRectangle(0, y, screenWidth, 2, Fade(BLACK, 0.2f * anim->alphaGeneral));
-    }
-
     // Play background jingle
     if (!IsSoundPlaying(sfxBgm) && !soundMuted) {
         PlaySound(sfxBgm);
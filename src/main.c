@@ -2,20 +2,78 @@
 #include "logo_animation.h"
 #include "rendering.h"
 #include "gui.h"
+#include "sprite_batch.h"
+#include "render_commands.h"
+#include "post_process.h"
+#include "screen_layout.h"
+#include "sprite_palette.h"
+#include "headless.h"
+#include "replay.h"
+#include "replay_video.h"
+#include "mosaic.h"
+#include "frame_pacer.h"
+
+#define TURBO_TICK_TIME (1.0f / 60.0f)     // Simulation step used for every turbo tick
+#define TURBO_FRAME_BUDGET (1.0 / 60.0 * 0.8) // Seconds of simulation per frame in "as fast as possible" mode
+#define MAX_TICK_TIME (1.0f / 10.0f)       // Longest frame time a single tick may simulate
+
+// Cycles the turbo speed 1x -> 2x -> 4x ... -> 64x -> as fast as possible (0) -> 1x
+static int next_turbo_speed(int speed) {
+    if (speed == 0) return 1;
+    if (speed >= 64) return 0;
+    return speed * 2;
+}
+
+int main(int argc, char *argv[]) {
+    // Frame dumps without a window or GPU (see headless.h)
+    if (is_headless_run(argc, argv)) {
+        return run_headless(argc, argv);
+    }
+
+    // Recorded sessions to video without a window (see replay_video.h)
+    if (is_replay_video_run(argc, argv)) {
+        return run_replay_video(argc, argv);
+    }
 
-int main(void) {
-    // Seed random number generator
+    // A grid of autopilot games in one window (see mosaic.h)
+    if (is_mosaic_run(argc, argv)) {
+        return run_mosaic(argc, argv);
+    }
+
+    // Save every game to REPLAY_DIRECTORY (--record), frame pacing (--pacing capped|vsync|uncapped)
+    bool recordReplays = false;
+    FramePacingMode pacingMode = FRAME_PACING_CAPPED;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--record") == 0) {
+            recordReplays = true;
+        } else if (strcmp(argv[i], "--pacing") == 0 && i + 1 < argc) {
+            i++;
+            for (int mode = 0; mode < FRAME_PACING_MODE_COUNT; mode++) {
+                if (TextIsEqual(TextToUpper(argv[i]), GetFramePacingModeName((FramePacingMode)mode))) {
+                    pacingMode = (FramePacingMode)mode;
+                }
+            }
+        }
+    }
+
+    // Seed random number generators
     SetRandomSeed((unsigned int)time(NULL));
+    simRandomState = (unsigned int)time(NULL);
 
     // Initialization
-    const int screenWidth = 1280;
-    const int screenHeight = 720;
-    InitWindow(screenWidth, screenHeight, "Pacman v1.0");
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);     // The virtual screen is scaled to whatever size the window gets
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Pacman v1.0");
     Image icon = LoadImage("assets/pac-man-logo-icon.ico");
     SetWindowIcon(icon);
         UnloadImage(icon);
     
-    SetTargetFPS(60);
+    InitFramePacer(pacingMode);
+
+    // CRT scanline/vignette/glow shader
+    InitPostProcess();
+
+    // Palette shader for the blinking power pellets and frightened ghosts
+    LoadSpritePalette();
 
     // Load a font
     Font font = LoadFont("assets/fonts/Emulogic-zrEw.ttf");
@@ -49,11 +107,9 @@ int main(void) {
     SetSoundVolume(sfx_extra_life, soundMuted ? 0.0f : sfxVolume);
     SetSoundVolume(sfx_game_over, soundMuted ? 0.0f : sfxVolume);
     
-    // Calculate maze dimensions and offsets
-    const int mazePixelWidth = MAZE_WIDTH * TILE_SIZE;              // 560px
-    const int mazePixelHeight = MAZE_HEIGHT * TILE_SIZE;            // 620px
-    const int mazeOffsetX = (screenWidth - mazePixelWidth) / 2;     // 360px (180px on each side)
-    const int mazeOffsetY = (screenHeight - mazePixelHeight) / 2;   // 50px (top and bottom)
+    // Lay every screen out for the initial window size; the layout is only recomputed when it changes
+    UpdateScreenLayout(font);
+    const ScreenLayout *layout = GetScreenLayout();
 
     // Menu variables
     int selectedOption = 0;
@@ -66,7 +122,7 @@ int main(void) {
     
     // Logo animation state
     LogoAnimation logoAnim;
-    init_personal_logo(&logoAnim, screenWidth, screenHeight);       // First state
+    init_personal_logo(&logoAnim, layout->canvasWidth, layout->canvasHeight);     // First state
 
     // Load ghost textures
     LoadGhostTextures(ghosts);
@@ -79,6 +135,7 @@ int main(void) {
 
     // Initialize GUI variables
     init_gui();
+    init_menu_background(layout->canvasWidth, layout->canvasHeight);
 
     // Fade to black transition variables
     float transitionAlpha = 0.0f;
@@ -90,6 +147,13 @@ int main(void) {
     float gameOverFadeAlpha = 0.0f; // Controls fade-in/out for game over screen
     bool gameOverFadingIn = true;   // True during fade-in, false during fade-out
 
+    // Debug overlays
+    bool showRenderStats = false;
+    HeatmapMode aiHeatmap = HEATMAP_NONE;
+
+    // Idle throttling: set while EndDrawing waits for input instead of running at 60 FPS
+    bool idleWaiting = false;
+
     // Disable ESC key from closing the window
     SetExitKey(KEY_F10);
 
@@ -97,9 +161,45 @@ int main(void) {
     // ----------------------------------------------------------------------------------------
     while (!(shouldExit || WindowShouldClose())) {
 
-        // Toggle fullscreen with F11
+        // Toggle fullscreen with F11. Borderless keeps the monitor's own resolution, the virtual
+        // screen is scaled up to it
         if (IsKeyPressed(KEY_F11)) {
-            ToggleFullscreen();
+            ToggleBorderlessWindowed();
+        }
+
+        // Lay the screens out again after a resize or a fullscreen toggle; every other frame just reads
+        // the cached positions. Without a virtual screen the canvas is the window, so the menu
+        // background is redrawn to match
+        if (UpdateScreenLayout(font)) {
+            init_menu_background(layout->canvasWidth, layout->canvasHeight);
+        }
+
+        // Toggle render stats with F1
+        if (IsKeyPressed(KEY_F1)) {
+            showRenderStats = !showRenderStats;
+        }
+
+        // Toggle CRT post processing with F4
+        if (IsKeyPressed(KEY_F4)) {
+            TogglePostProcess();
+        }
+
+        // Cycle frame pacing with F5 (capped 60 FPS, vsync, uncapped)
+        if (IsKeyPressed(KEY_F5)) {
+            SetFramePacingMode((FramePacingMode)((GetFramePacingMode() + 1) % FRAME_PACING_MODE_COUNT));
+        }
+
+        // Toggle the AI overlay with F6, cycle its heatmap with F7
+        if (IsKeyPressed(KEY_F6)) {
+            aiDebugEnabled = !aiDebugEnabled;
+        }
+        if (IsKeyPressed(KEY_F7)) {
+            aiHeatmap = (HeatmapMode)((aiHeatmap + 1) % HEATMAP_MODE_COUNT);
+        }
+
+        // Switch between the cached wall texture and the wall mesh with F3
+        if (IsKeyPressed(KEY_F3)) {
+            wallRenderMode = (wallRenderMode == WALL_RENDER_TEXTURE) ? WALL_RENDER_MESH : WALL_RENDER_TEXTURE;
         }
 
         // Handle Enter key to skip animations
@@ -109,7 +209,7 @@ int main(void) {
                     logoAnim.skip = true;
                     fadingOut = true;
                     nextState = STATE_RAYLIB_LOGO;
-                    init_raylib_logo(&logoAnim, screenWidth, screenHeight);
+                    init_raylib_logo(&logoAnim, layout->canvasWidth, layout->canvasHeight);
                     if (!soundMuted) {
                         PlaySound(sfx_menu_nav);
                     }
@@ -228,253 +328,251 @@ int main(void) {
             }
         }
 
-        switch (gameState) {
-            case STATE_PERSONAL_LOGO:
-                if (update_personal_logo(&logoAnim)) {
-                    fadingOut = true;
-                    nextState = STATE_RAYLIB_LOGO;
-                    init_raylib_logo(&logoAnim, screenWidth, screenHeight);
-                }
-                break;
+        // Turbo: run several simulation ticks per rendered frame (F2 cycles the speed).
+        // Only gameplay states are fast-forwarded; menus and fades always run once per frame.
+        if (IsKeyPressed(KEY_F2)) {
+            turboSpeed = next_turbo_speed(turboSpeed);
+            SetMasterVolume(turboSpeed == 1 ? 1.0f : 0.0f);     // Mute rather than play sounds at turbo rate
+        }
 
-            case STATE_RAYLIB_LOGO:
-                if (update_raylib_logo(&logoAnim)) {
-                    fadingOut = true;
-                    nextState = STATE_LOGO;
-                    init_game_logo(&logoAnim);
-                }
-                break;
+        bool turboActive = turboSpeed != 1 && is_simulation_state(gameState);
+        int ticksThisFrame = !turboActive ? 1 : (turboSpeed == 0 ? INT_MAX : turboSpeed);
+        double turboDeadline = GetTime() + TURBO_FRAME_BUDGET;
 
-            case STATE_LOGO:
-                if (update_game_logo(&logoAnim)) {
-                    fadingOut = true;
-                    nextState = STATE_MENU;
-                }
-                break;
+        // A session is recorded from its first gameplay tick until the game returns to the menu or ends
+        if (recordReplays) {
+            if (is_simulation_state(gameState) && !is_replay_recording()) {
+                start_replay_recording();
+            } else if ((gameState == STATE_MENU || gameState == STATE_GAME_OVER) && is_replay_recording()) {
+                stop_replay_recording(REPLAY_DIRECTORY);
+            }
+        }
 
-            case STATE_MENU:
-                // Start menu loop sound
-                if (!IsSoundPlaying(sfx_menu) && !soundMuted) {
-                    StopSound(sfx_game_over);
-                    SetSoundVolume(sfx_menu, bgMusicVolume * 0.3f);
-                    PlaySound(sfx_menu);
-                    isMenuLoopPlaying = true;
-                }
-                handle_menu_input(&selectedOption, &shouldExit);
-                if (shouldExit) {
-                    fadingOut = true;
-                    nextState = STATE_MENU;
-                }
-                break; 
+        for (int tick = 0; tick < ticksThisFrame; tick++) {
+            // Turbo ticks use the nominal 60 Hz step so a fast-forwarded game plays out exactly like a normal one.
+            // Otherwise the frame time is capped: raylib counts an idle wait (EndDrawing blocks for input while
+            // paused) in the frame time one or two frames later, after the game is already back to PLAYING,
+            // and a stall of any kind must not be simulated as one giant step.
+            simDeltaTime = turboActive ? TURBO_TICK_TIME : fminf(GetFrameTime(), MAX_TICK_TIME);
+
+            // Input is read here rather than in update_pacman so replays can record it
+            Direction input = (gameState == STATE_PLAYING) ? read_direction_input() : DIR_NONE;
+            bool recordTick = is_replay_recording() && is_simulation_state(gameState);
+            if (recordTick) {
+                record_replay_tick(simDeltaTime, input);
+            }
+            if (input != DIR_NONE) {
+                pacman.nextDirection = input;
+            }
 
-            case STATE_HIGHSCORES:
-                handle_highscores_input(&selectedOption);
-                break;
+            switch (gameState) {
+                case STATE_PERSONAL_LOGO:
+                    if (update_personal_logo(&logoAnim)) {
+                        fadingOut = true;
+                        nextState = STATE_RAYLIB_LOGO;
+                        init_raylib_logo(&logoAnim, layout->canvasWidth, layout->canvasHeight);
+                    }
+                    break;
 
-            case STATE_ABOUT:
-                handle_about_input(&selectedOption);
-                break;
+                case STATE_RAYLIB_LOGO:
+                    if (update_raylib_logo(&logoAnim)) {
+                        fadingOut = true;
+                        nextState = STATE_LOGO;
+                        init_game_logo(&logoAnim);
+                    }
+                    break;
 
-            case STATE_SETTINGS:
-                handle_settings_input(&selectedOption);
-                break;
-            
-            case STATE_READY:
-                // Ensure menu loop stops when entering READY
-                if (isMenuLoopPlaying) {
-                    StopSound(sfx_menu);
-                    isMenuLoopPlaying = false;
-                }
+                case STATE_LOGO:
+                    if (update_game_logo(&logoAnim)) {
+                        fadingOut = true;
+                        nextState = STATE_MENU;
+                    }
+                    break;
 
-                // Stop movement sound
-                StopSound(sfx_pacman_move);
-                playPacmanMove = false;
+                case STATE_MENU:
+                    // Start menu loop sound
+                    if (!IsSoundPlaying(sfx_menu) && !soundMuted) {
+                        StopSound(sfx_game_over);
+                        SetSoundVolume(sfx_menu, bgMusicVolume * 0.3f);
+                        PlaySound(sfx_menu);
+                        isMenuLoopPlaying = true;
+                    }
+                    handle_menu_input(&selectedOption, &shouldExit);
+                    if (shouldExit) {
+                        fadingOut = true;
+                        nextState = STATE_MENU;
+                    }
+                    break; 
 
-                readyTimer -= GetFrameTime();
-                if (readyTimer <= 0.0f) {
-                    gameState = STATE_PLAYING;
-                    readyTimer = 0.0f;
-                    StopSound(sfx_ready);
-                    playPacmanMove = true;      // Start movement sfx when entering PLAYING
-                }
-                break;
-            
-            case STATE_PLAYING:
-                update_pacman();
-                update_ghosts();
-                update_fruit();
+                case STATE_HIGHSCORES:
+                    handle_highscores_input(&selectedOption);
+                    break;
 
-                if (!soundMuted && !IsSoundPlaying(sfx_pacman_move)) {
-                    SetSoundVolume(sfx_pacman_move, bgMusicVolume * 0.3f);
-                    PlaySound(sfx_pacman_move);
-                }
-                if (powerPelletTimer > 0.0f) {
-                    powerPelletTimer -= GetFrameTime();
-                    if (powerPelletTimer < 0.0f) {
-                        powerPelletTimer = 0.0f;
-                    }
-                }
-        
-                if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_P)) {
-                    gameState = STATE_PAUSED;
-                    playPacmanMove = false;
-                    StopSound(sfx_pacman_move);
-                }
-                break;
+                case STATE_ABOUT:
+                    handle_about_input(&selectedOption);
+                    break;
 
-            case STATE_PAUSED:
-                if (IsKeyPressed(KEY_ESCAPE)) {
-                    gameState = STATE_PLAYING;
-                    playPacmanMove = true;      // Resume movement sfx
-                }
-                // Stop movement sound when entering pause
-                if (!pausedThisFrame) {
-                    StopSound(sfx_pacman_move);
-                    playPacmanMove = false;
-                }
+                case STATE_SETTINGS:
+                    handle_settings_input(&selectedOption);
+                    break;
+            
+                case STATE_READY:
+                case STATE_PLAYING:
+                case STATE_GHOST_EATEN:
+                case STATE_DEATH_ANIM:
+                case STATE_LEVEL_COMPLETE: {
+                    // Sounds for the state being entered
+                    if (gameState == STATE_READY) {
+                        // Ensure menu loop stops when entering READY
+                        if (isMenuLoopPlaying) {
+                            StopSound(sfx_menu);
+                            isMenuLoopPlaying = false;
+                        }
 
-                if (handle_pause_input(&pausedThisFrame)) {
-                    if (pauseSelectedOption == 3) { // Quit
-                        fadingOut = true;
-                        nextState = STATE_MENU;
-                        prevState = STATE_PAUSED;
-                        playPacmanMove = true;
+                        // Stop movement sound
+                        StopSound(sfx_pacman_move);
+                        playPacmanMove = false;
+                    } else if (gameState == STATE_DEATH_ANIM && !deathSfxPlayed && !soundMuted) {
+                        // Play death sound once when entering state
+                        StopSound(sfx_pacman_move);
+                        StopSound(sfx_ghost_frightened);
+                        SetSoundVolume(sfx_pacman_death, sfxVolume);
+                        PlaySound(sfx_pacman_death);
+                        deathSfxPlayed = true;
+                    } else if (gameState == STATE_LEVEL_COMPLETE && !levelCompleteSfxStopped && !soundMuted) {
+                        // Play level complete sound once when entering state
                         StopSound(sfx_pacman_move);
+                        StopSound(sfx_ghost_frightened);
+                        SetSoundVolume(sfx_level_complete, sfxVolume);
+                        PlaySound(sfx_level_complete);
+                        levelCompleteSfxStopped = true;
                     }
-                }
-                pausedThisFrame = false;
-                break;
 
-            case STATE_GHOST_EATEN:
-                ghostEatenTimer -= GetFrameTime();
-                if (ghostEatenTimer <= 0.0f) {
-                    eatenGhostIndex = -1;   // Reset for next ghost
-                    gameState = STATE_PLAYING;
-                    playPacmanMove = true;
-                    // Resume frightened sound if any ghost is still frightened
-                    if (isFrightenedSoundPaused) {
-                        bool anyFrightened = false;
-                        for (int i = 0; i < MAX_GHOSTS; i++) {
-                            if (ghosts[i].state == GHOST_FRIGHTENED && ghosts[i].stateTimer > 0.0f) {
-                                anyFrightened = true;
-                                break;
+                    // The simulation itself is the same tick headless runs and replays play
+                    GameState stateBefore = gameState;
+                    GameplayEvent event = step_gameplay();
+
+                    if (stateBefore == STATE_READY && gameState == STATE_PLAYING) {
+                        StopSound(sfx_ready);
+                        playPacmanMove = true;      // Start movement sfx when entering PLAYING
+                    } else if (stateBefore == STATE_GHOST_EATEN && gameState == STATE_PLAYING) {
+                        playPacmanMove = true;
+                        // Resume frightened sound if any ghost is still frightened
+                        if (isFrightenedSoundPaused) {
+                            bool anyFrightened = false;
+                            for (int i = 0; i < MAX_GHOSTS; i++) {
+                                if (ghosts[i].state == GHOST_FRIGHTENED && ghosts[i].stateTimer > 0.0f) {
+                                    anyFrightened = true;
+                                    break;
+                                }
+                            }
+                            if (anyFrightened && !soundMuted) {
+                                SetSoundVolume(sfx_ghost_frightened, sfxVolume);
+                                ResumeSound(sfx_ghost_frightened);
+                                isFrightenedSoundPaused = false;
+                            } else {
+                                StopSound(sfx_ghost_frightened);
+                                isFrightenedSoundPaused = false;
                             }
                         }
-                        if (anyFrightened && !soundMuted) {
-                            SetSoundVolume(sfx_ghost_frightened, sfxVolume);
-                            ResumeSound(sfx_ghost_frightened);
-                            isFrightenedSoundPaused = false;
-                        } else {
-                            StopSound(sfx_ghost_frightened);
-                            isFrightenedSoundPaused = false;
-                        }
+                    } else if (stateBefore == STATE_DEATH_ANIM && gameState == STATE_READY) {
+                        // A life was lost and the round restarts
+                        deathSfxPlayed = false;     // Reset flag for next death
+                        playPacmanMove = false;
                     }
-                }
-                break;
-
-            case STATE_DEATH_ANIM:
-                // Play death sound once when entering state
-                if (!deathSfxPlayed && !soundMuted) {
-                    StopSound(sfx_pacman_move);
-                    StopSound(sfx_ghost_frightened);
-                    SetSoundVolume(sfx_pacman_death, sfxVolume);
-                    PlaySound(sfx_pacman_death);
-                    deathSfxPlayed = true;
-                }
 
-                deathAnimTimer -= GetFrameTime();
-                if (deathAnimTimer <= 0.0f) {
-                    // Update death animation frame based on time
-                    // Total animation duration is 2 seconds (reduced from 6 for consistency)
-                    float frameDuration = 2.0f / PACMAN_DEATH_FRAMES;
-                    int newFrame = (int)((2.0f - deathAnimTimer) / frameDuration);
-                    deathAnimFrame = (newFrame < PACMAN_DEATH_FRAMES) ? newFrame : (PACMAN_DEATH_FRAMES - 1);
-
-                    // Decrement lives at the end of the animation
-                    pacman.lives--;
-                    if (pacman.lives > 0) {
-                        reset_game_state(false, STATE_READY);
-                        gameState = STATE_READY;
-                        deathAnimTimer = 2.0f;  // Reset timer for next death
-                        deathAnimFrame = 0;
-                        deathSfxPlayed = false; // Reset flag for next death
-                        playPacmanMove = false;
-                    } else {
+                    if (event == GAMEPLAY_GAME_OVER) {
                         // Delay game over transition to allow animation to complete
                         fadingOut = true;
                         nextState = STATE_GAME_OVER;
                         prevState = STATE_DEATH_ANIM;
                         gameOverFadeAlpha = 0.0f;
                         gameOverFadingIn = true;
-                        deathAnimTimer = 2.0f;  // Reset timer
-                        deathAnimFrame = 0;
-                        deathSfxPlayed = false; // Reset flag
+                        deathSfxPlayed = false;     // Reset flag
+                        playPacmanMove = false;
+                        StopSound(sfx_pacman_move);
+                    } else if (event == GAMEPLAY_NEXT_LEVEL) {
+                        // The next maze is loaded once the fade to READY completes
+                        prevState = STATE_LEVEL_COMPLETE;
+                        fadingOut = true;
+                        nextState = STATE_READY;
+                        levelCompleteSfxStopped = false;    // Reset flag for next level
                         playPacmanMove = false;
                         StopSound(sfx_pacman_move);
                     }
-                } else {
-                    // Update death animation frame based on time
-                    // Total animation duration is 2 seconds
-                    float frameDuration = 2.0f / PACMAN_DEATH_FRAMES;
-                    int newFrame = (int)((2.0f - deathAnimTimer) / frameDuration);
-                    deathAnimFrame = (newFrame < PACMAN_DEATH_FRAMES) ? newFrame : (PACMAN_DEATH_FRAMES - 1);
-                }
-                break;
 
-            case STATE_LEVEL_COMPLETE:
-                // Play level complete sound once when entering state
-                if (!levelCompleteSfxStopped && !soundMuted) {
-                    StopSound(sfx_pacman_move);
-                    StopSound(sfx_ghost_frightened);
-                    SetSoundVolume(sfx_level_complete, sfxVolume);
-                    PlaySound(sfx_level_complete);
-                    levelCompleteSfxStopped = true;
+                    if (gameState == STATE_PLAYING) {
+                        if (!soundMuted && !IsSoundPlaying(sfx_pacman_move)) {
+                            SetSoundVolume(sfx_pacman_move, bgMusicVolume * 0.3f);
+                            PlaySound(sfx_pacman_move);
+                        }
+                        if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_P)) {
+                            gameState = STATE_PAUSED;
+                            playPacmanMove = false;
+                            StopSound(sfx_pacman_move);
+                        }
+                    }
+                    break;
                 }
 
-                // Wait for a brief moment before transitioning
-                deathAnimTimer -= GetFrameTime();   // Reuse for timing
-                if (deathAnimTimer <= 0.0f) {
-                    prevState = STATE_LEVEL_COMPLETE;
-                    fadingOut = true;
-                    nextState = STATE_READY;
-                    deathAnimTimer = 6.0f;      // Reset timer
-                    reset_game_state(false, STATE_READY);
-                    //level++;                    // Increment level for next iteration
-                    levelCompleteSfxStopped = false;    // Reset flag for next level
-                    playPacmanMove = false;
-                    StopSound(sfx_pacman_move);
-                }
-                break;
+                case STATE_PAUSED:
+                    if (IsKeyPressed(KEY_ESCAPE)) {
+                        gameState = STATE_PLAYING;
+                        playPacmanMove = true;      // Resume movement sfx
+                    }
+                    // Stop movement sound when entering pause
+                    if (!pausedThisFrame) {
+                        StopSound(sfx_pacman_move);
+                        playPacmanMove = false;
+                    }
 
-            case STATE_GAME_OVER:
-                handle_game_over_input(&selectedOption);
-                break;
+                    if (handle_pause_input(&pausedThisFrame)) {
+                        if (pauseSelectedOption == 3) { // Quit
+                            fadingOut = true;
+                            nextState = STATE_MENU;
+                            prevState = STATE_PAUSED;
+                            playPacmanMove = true;
+                            StopSound(sfx_pacman_move);
+                        }
+                    }
+                    pausedThisFrame = false;
+                    break;
+
+                case STATE_GAME_OVER:
+                    handle_game_over_input(&selectedOption);
+                    break;
         
-            default:
+                default:
+                    break;
+            }
+
+            if (recordTick) {
+                finish_replay_tick();
+            }
+
+            // Stop fast-forwarding once the game leaves gameplay or a fade starts
+            if (fadingOut || !is_simulation_state(gameState)) {
                 break;
+            }
+            // "As fast as possible" runs until this frame's time budget is spent
+            if (turboSpeed == 0 && GetTime() >= turboDeadline) {
+                break;
+            }
         }
 
         // Start Rendering
         // ----------------------------------------------------------------------------------------
-        BeginDrawing();
-        ClearBackground(BLACK);
-
-        // Render lives as Pac-Man sprites
-        float scaleFactor = (float)TILE_SIZE / 16.0f;
-        float scaledWidth = 16.0f * scaleFactor;
-        float scaledHeight = 16.0f * scaleFactor;
+        RefreshMazeTextures();
+        RefreshHudLayer(&font, &layout->gameplay);
 
-        Rectangle sourceRec = { 18.0f, 0.0f, 16.0f, 16.0f};
-        Vector2 origin = { scaledWidth / 2.0f, scaledHeight / 2.0f};
-        float livesStartX = mazeOffsetX + mazePixelWidth - 80;
+        BeginPostProcess(gameState);
+        ClearBackground(BLACK);
 
-        // Render collected fruits
-        Rectangle fruitSourceRec = { 35.0f, 48.0f, 16.0f, 16.0f};
-        float fruitsStartX = mazeOffsetX + 50;
+        SpriteBatchNewFrame();
 
         switch (gameState) {
             case STATE_PERSONAL_LOGO:
-                render_personal_logo(&logoAnim, screenWidth, screenHeight, font, sfx_menu_nav);
+                render_personal_logo(&logoAnim, layout->canvasWidth, layout->canvasHeight, font, sfx_menu_nav);
                 break;
 
             case STATE_RAYLIB_LOGO:
@@ -482,231 +580,125 @@ int main(void) {
                 break;
 
             case STATE_LOGO:
-                render_game_logo(&logoAnim, screenWidth, screenHeight, font, pacman.sprite, ghosts, sfx_menu_nav, sfx_ready);
+                render_game_logo(&logoAnim, layout->canvasWidth, layout->canvasHeight, font, pacman.sprite, ghosts, sfx_menu_nav, sfx_ready);
                 break;
 
             case STATE_MENU:
-                render_menu(screenWidth, screenHeight, font, selectedOption, pacman.sprite, ghosts);
+                render_menu(layout, font, selectedOption, pacman.sprite, ghosts);
                 break;
 
             case STATE_HIGHSCORES:
-                render_highscores(screenWidth, screenHeight, font);
+                render_highscores(layout, font);
                 break;
 
             case STATE_ABOUT:
-                render_about(screenWidth, screenHeight, font);
+                render_about(layout, font);
                 break;
 
             case STATE_SETTINGS:
-                render_settings_menu(screenWidth, screenHeight, font, selectedOption);
+                render_settings_menu(layout, font, selectedOption);
                 break;
 
             case STATE_READY:
-                ClearBackground(BLACK);
-                render_maze(mazeOffsetX, mazeOffsetY);
-                render_pacman(mazeOffsetX, mazeOffsetY);
-                render_ghosts(mazeOffsetX, mazeOffsetY);
-                DrawTextEx(font, "READY!", (Vector2){screenWidth / 2 - 35, mazeOffsetY + (14 * TILE_SIZE + 3)}, 16.0f, 1, YELLOW);
-                DrawTextEx(font, "Score: ", (Vector2){mazeOffsetX + 10, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", pacman.score), (Vector2){mazeOffsetX + 30, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Level: ", (Vector2){mazeOffsetX + mazePixelWidth - 100, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", level), (Vector2){mazeOffsetX + mazePixelWidth - 70, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "High Score: ", (Vector2){screenWidth / 2 - 70, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", highscores[0].score), (Vector2){screenWidth / 2 - 50, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Lives: ", (Vector2){mazeOffsetX + mazePixelWidth - 170, screenHeight - 40}, 16.0f, 1, WHITE);
-                // Draw lives as Pac-Man sprites
-                for (int i = 0; i < pacman.lives; i++) {
-                    Rectangle destRec = {
-                        livesStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30,
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
-                }
-
-                // Draw collected fruits
-                for (int i = 0; i < totalFruitsCollected; i++) {
-                    Rectangle destRec = {
-                        fruitsStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30, // Same row as lives
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(fruit.sprite, fruitSourceRec, destRec, origin, 0.0f, WHITE);
-                }
-                break;
-
             case STATE_PLAYING:
             case STATE_GHOST_EATEN:
-                ClearBackground(BLACK);
-                render_maze(mazeOffsetX, mazeOffsetY);
-                render_pacman(mazeOffsetX, mazeOffsetY);
-                render_ghosts(mazeOffsetX, mazeOffsetY);
-                render_fruit(mazeOffsetX, mazeOffsetY);
-                DrawTextEx(font, "Score: ", (Vector2){mazeOffsetX + 10, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", pacman.score), (Vector2){mazeOffsetX + 30, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Level: ", (Vector2){mazeOffsetX + mazePixelWidth - 100, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", level), (Vector2){mazeOffsetX + mazePixelWidth - 70, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "High Score: ", (Vector2){screenWidth / 2 - 70, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", highscores[0].score), (Vector2){screenWidth / 2 - 50, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Lives: ", (Vector2){mazeOffsetX + mazePixelWidth - 170, screenHeight - 40}, 16.0f, 1, WHITE);
-                // Draw lives as Pac-Man sprites
-                for (int i = 0; i < pacman.lives; i++) {
-                    Rectangle destRec = {
-                        livesStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30,
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
-                }
-
-                // Draw collected fruits
-                for (int i = 0; i < totalFruitsCollected; i++) {
-                    Rectangle destRec = {
-                        fruitsStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30, // Same row as lives
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(fruit.sprite, fruitSourceRec, destRec, origin, 0.0f, WHITE);
-                }
-                break;
-
             case STATE_PAUSED:
-                render_maze(mazeOffsetX, mazeOffsetY);
-                render_pacman(mazeOffsetX, mazeOffsetY);
-                render_ghosts(mazeOffsetX, mazeOffsetY);
-                render_fruit(mazeOffsetX, mazeOffsetY);
-                DrawTextEx(font, "Score: ", (Vector2){mazeOffsetX + 10, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", pacman.score), (Vector2){mazeOffsetX + 30, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Level: ", (Vector2){mazeOffsetX + mazePixelWidth - 100, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", level), (Vector2){mazeOffsetX + mazePixelWidth - 70, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "High Score: ", (Vector2){screenWidth / 2 - 70, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", highscores[0].score), (Vector2){screenWidth / 2 - 50, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Lives: ", (Vector2){mazeOffsetX + mazePixelWidth - 170, screenHeight - 40}, 16.0f, 1, WHITE);
-                // Draw lives as Pac-Man sprites
-                for (int i = 0; i < pacman.lives; i++) {
-                    Rectangle destRec = {
-                        livesStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30,
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
-                }
-
-                // Draw collected fruits
-                for (int i = 0; i < totalFruitsCollected; i++) {
-                    Rectangle destRec = {
-                        fruitsStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30, // Same row as lives
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(fruit.sprite, fruitSourceRec, destRec, origin, 0.0f, WHITE);
-                }
-                // Render pause menu
-                render_pause_menu(screenWidth, screenHeight, font);
-                break;
-
             case STATE_DEATH_ANIM:
-                ClearBackground(BLACK);
-                render_maze(mazeOffsetX, mazeOffsetY);
-                render_pacman_death(mazeOffsetX, mazeOffsetY);
-                DrawTextEx(font, "Score: ", (Vector2){mazeOffsetX + 10, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", pacman.score), (Vector2){mazeOffsetX + 30, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Level: ", (Vector2){mazeOffsetX + mazePixelWidth - 100, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", level), (Vector2){mazeOffsetX + mazePixelWidth - 70, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "High Score: ", (Vector2){screenWidth / 2 - 70, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", highscores[0].score), (Vector2){screenWidth / 2 - 50, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Lives: ", (Vector2){mazeOffsetX + mazePixelWidth - 170, screenHeight - 40}, 16.0f, 1, WHITE);
-                // Draw lives as Pac-Man sprites
-                for (int i = 0; i < pacman.lives; i++) {
-                    Rectangle destRec = {
-                        livesStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30,
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
-                }
-
-                // Draw collected fruits
-                for (int i = 0; i < totalFruitsCollected; i++) {
-                    Rectangle destRec = {
-                        fruitsStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30, // Same row as lives
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(fruit.sprite, fruitSourceRec, destRec, origin, 0.0f, WHITE);
-                }
-                break;
-
             case STATE_LEVEL_COMPLETE:
-                ClearBackground(BLACK);
-                render_maze(mazeOffsetX, mazeOffsetY);
-                render_pacman(mazeOffsetX, mazeOffsetY);
-                render_ghosts(mazeOffsetX, mazeOffsetY);
-                render_fruit(mazeOffsetX, mazeOffsetY);
-
-                // Call the new GUI function for level complete screen
-                render_level_complete(screenWidth, screenHeight, font, deathAnimTimer, level,
-                         pelletsEaten, powerPelletsEaten, totalGhostsEaten,
-                         totalFruitsCollected, fruit.points);
-
-                // Standard HUD elements
-                DrawTextEx(font, "Score: ", (Vector2){mazeOffsetX + 10, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", pacman.score), (Vector2){mazeOffsetX + 30, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Level: ", (Vector2){mazeOffsetX + mazePixelWidth - 100, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", level), (Vector2){mazeOffsetX + mazePixelWidth - 70, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "High Score: ", (Vector2){screenWidth / 2 - 70, 10}, 16.0f, 1, WHITE);
-                DrawTextEx(font, TextFormat("%d", highscores[0].score), (Vector2){screenWidth / 2 - 50, 25}, 16.0f, 1, WHITE);
-                DrawTextEx(font, "Lives: ", (Vector2){mazeOffsetX + mazePixelWidth - 170, screenHeight - 40}, 16.0f, 1, WHITE);
-                // Draw lives as Pac-Man sprites
-                for (int i = 0; i < pacman.lives; i++) {
-                    Rectangle destRec = {
-                        livesStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30,
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
+                // The gameplay screen is recorded as commands and drawn in one submission
+                BeginRenderCommands();
+                render_gameplay(&layout->gameplay);
+                if (aiDebugEnabled) {
+                    render_ai_overlay(&font, layout->gameplay.mazeOffsetX, layout->gameplay.mazeOffsetY, aiHeatmap);
+                }
+                if (gameState == STATE_READY) {
+                    PushTextCommand(&font, "READY!", layout->gameplay.readyText, 16.0f, 1, YELLOW);
                 }
+                SubmitRenderCommands(RENDER_BACKEND_RAYLIB);
 
-                // Draw collected fruits
-                for (int i = 0; i < totalFruitsCollected; i++) {
-                    Rectangle destRec = {
-                        fruitsStartX + (i * (scaledWidth + 5)),
-                        screenHeight - 30, // Same row as lives
-                        scaledWidth,
-                        scaledHeight
-                    };
-                    DrawTexturePro(fruit.sprite, fruitSourceRec, destRec, origin, 0.0f, WHITE);
+                // Menus drawn over the scene
+                if (gameState == STATE_PAUSED) {
+                    render_pause_menu(layout, font);
+                } else if (gameState == STATE_LEVEL_COMPLETE) {
+                    render_level_complete(layout, font, deathAnimTimer, level,
+                             pelletsEaten, powerPelletsEaten, totalGhostsEaten,
+                             totalFruitsCollected, fruit.points);
                 }
                 break;
 
             case STATE_GAME_OVER:
-                render_game_over(screenWidth, screenHeight, font, gameOverFadeAlpha);
+                render_game_over(layout, font, gameOverFadeAlpha);
                 break;
 
             default:
                 break;
         }
 
+        // Scale to the window and apply the CRT effects; overlays below are drawn unprocessed,
+        // in window coordinates
+        EndPostProcess(layout->virtualScreen);
+
+        // Render stats (F1)
+        if (showRenderStats) {
+            SpriteBatchStats stats = GetSpriteBatchStats();
+            RenderCommandStats commandStats = GetRenderCommandStats();
+            DrawTextEx(font, TextFormat("FPS %d  CMDS %d  SPRITES %d  DRAWS %d  BREAKS %d", GetFPS(), commandStats.commands,
+                                        stats.sprites, stats.drawCalls, stats.batchBreaks),
+                       layout->renderStatsLine, 10.0f, 1, GREEN);
+
+            FrameTimeStats frameStats = GetFrameTimeStats();
+            DrawTextEx(font, TextFormat("%s  AVG %.2fMS  P99 %.2fMS  MAX %.2fMS  MISSED %d", GetFramePacingModeName(GetFramePacingMode()),
+                                        frameStats.averageMs, frameStats.p99Ms, frameStats.maxMs, frameStats.missedDeadlines),
+                       layout->frameStatsLine, 10.0f, 1, GREEN);
+            DrawFrameTimeHistogram(layout->frameHistogram, GREEN);
+        }
+
+        // Turbo indicator
+        if (turboSpeed != 1) {
+            const char *turboText = (turboSpeed == 0) ? "TURBO MAX" : TextFormat("TURBO x%d", turboSpeed);
+            DrawTextEx(font, turboText, (Vector2){10, 10}, 16.0f, 1, ORANGE);
+        }
+
         // Draw fade-to-black transition
         if (transitionAlpha > 0.0f) {
-            DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, transitionAlpha));
+            DrawRectangleRec(layout->window, Fade(BLACK, transitionAlpha));
+        }
+
+        // A static screen (no animation, no fade) looks the same until a key is pressed, so stop redrawing
+        // it: EndDrawing then sleeps until the next input or window event instead of pacing 60 FPS
+        bool staticScreen = gameState == STATE_HIGHSCORES || gameState == STATE_ABOUT || gameState == STATE_SETTINGS ||
+                            gameState == STATE_PAUSED || (gameState == STATE_GAME_OVER && !gameOverFadingIn && nameInputComplete);
+        bool idle = staticScreen && !fadingOut && transitionAlpha == 0.0f && !showRenderStats;
+        if (idle != idleWaiting) {
+            if (idle) {
+                EnableEventWaiting();
+            } else {
+                DisableEventWaiting();
+            }
+            idleWaiting = idle;
         }
 
         EndDrawing();
+
+        // An idle frame has already waited for input inside EndDrawing
+        if (idleWaiting) {
+            ResyncFramePacer();
+        } else {
+            WaitForNextFrame();
+        }
+
+        // Everything drawn this frame has consumed the tile changes
+        clear_tile_journal();
         // ----------------------------------------------------------------------------------------
     }
 
     // De-Initialization
     // ----------------------------------------------------------------------------------------
+    stop_replay_recording(REPLAY_DIRECTORY);    // Keep a game that was still running
+    FrameTimeStats frameStats = GetFrameTimeStats();
+    printf("Frame times (%s): %d frames, avg %.2f ms, p99 %.2f ms, max %.2f ms, %d missed deadlines\n",
+           GetFramePacingModeName(GetFramePacingMode()), frameStats.frames, frameStats.averageMs,
+           frameStats.p99Ms, frameStats.maxMs, frameStats.missedDeadlines);
     UnloadFont(font);
     UnloadSound(sfx_menu);
     UnloadSound(sfx_menu_nav);
@@ -721,6 +713,11 @@ int main(void) {
     UnloadSound(sfx_extra_life);
     UnloadSound(sfx_game_over);
     UnloadGhostTextures(ghosts);
+    UnloadMazeTextures();
+    UnloadHudLayer();
+    UnloadPostProcess();
+    UnloadSpritePalette();
+    unload_menu_background();
     UnloadTexture(pacman.sprite);
     UnloadTexture(fruit.sprite);
     CloseAudioDevice();
@@ -0,0 +1,202 @@
+#include "maze_mesh.h"
+#include "rlgl.h"
+#include "raymath.h"
+
+#define WALL_ARC_SEGMENTS 16        // Same tessellation as DrawArc in render_maze
+#define WALL_LINE_THICKNESS 1.0f
+
+static Mesh wallMesh = { 0 };
+static Material wallMaterial = { 0 };
+static bool wallMeshLoaded = false;
+
+// cos/sin of a quarter circle, evaluated once and rotated into each corner
+static float arcCos[WALL_ARC_SEGMENTS + 1];
+static float arcSin[WALL_ARC_SEGMENTS + 1];
+static bool arcTableReady = false;
+
+// Geometry Builder
+// ----------------------------------------------------------------------------------------
+// With vertices == NULL the builder only counts, so the same walk sizes the buffers and fills them.
+typedef struct {
+    float *vertices;
+    unsigned short *indices;
+    int vertexCount;
+    int indexCount;
+} WallMeshBuilder;
+
+static void push_vertex(WallMeshBuilder *builder, float x, float y) {
+    if (builder->vertices) {
+        builder->vertices[builder->vertexCount * 3 + 0] = x;
+        builder->vertices[builder->vertexCount * 3 + 1] = y;
+        builder->vertices[builder->vertexCount * 3 + 2] = 0.0f;
+    }
+    builder->vertexCount ++;
+}
+
+static void push_triangle(WallMeshBuilder *builder, int a, int b, int c) {
+    if (builder->indices) {
+        builder->indices[builder->indexCount + 0] = (unsigned short)a;
+        builder->indices[builder->indexCount + 1] = (unsigned short)b;
+        builder->indices[builder->indexCount + 2] = (unsigned short)c;
+    }
+    builder->indexCount += 3;
+}
+
+// Adds a straight segment as a quad of the wall line thickness
+static void add_segment(WallMeshBuilder *builder, Vector2 start, Vector2 end) {
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f) {
+        return;
+    }
+    float nx = -dy / length * (WALL_LINE_THICKNESS / 2.0f);
+    float ny = dx / length * (WALL_LINE_THICKNESS / 2.0f);
+
+    int base = builder->vertexCount;
+    push_vertex(builder, start.x + nx, start.y + ny);
+    push_vertex(builder, start.x - nx, start.y - ny);
+    push_vertex(builder, end.x + nx, end.y + ny);
+    push_vertex(builder, end.x - nx, end.y - ny);
+    push_triangle(builder, base + 0, base + 1, base + 2);
+    push_triangle(builder, base + 1, base + 3, base + 2);
+}
+
+// Adds a quarter-circle arc as a strip of quads between the inner and outer edge of the line.
+// quadrant selects the start angle: 0 = 0 deg, 1 = 90 deg, 2 = 180 deg, 3 = 270 deg.
+static void add_arc(WallMeshBuilder *builder, Vector2 center, float radius, int quadrant) {
+    float inner = radius - WALL_LINE_THICKNESS / 2.0f;
+    float outer = radius + WALL_LINE_THICKNESS / 2.0f;
+
+    int base = builder->vertexCount;
+    for (int i = 0; i <= WALL_ARC_SEGMENTS; i++) {
+        // Rotate the first-quadrant table by quadrant * 90 degrees
+        float c = arcCos[i];
+        float s = arcSin[i];
+        float dirX, dirY;
+        switch (quadrant) {
+            case 1:  dirX = -s; dirY = c;  break;
+            case 2:  dirX = -c; dirY = -s; break;
+            case 3:  dirX = s;  dirY = -c; break;
+            default: dirX = c;  dirY = s;  break;
+        }
+        push_vertex(builder, center.x + dirX * inner, center.y + dirY * inner);
+        push_vertex(builder, center.x + dirX * outer, center.y + dirY * outer);
+    }
+    for (int i = 0; i < WALL_ARC_SEGMENTS; i++) {
+        int v = base + i * 2;
+        push_triangle(builder, v, v + 1, v + 2);
+        push_triangle(builder, v + 1, v + 3, v + 2);
+    }
+}
+
+// Walks the maze and emits the same outline render_maze draws with DrawLineEx/DrawArc
+static void emit_wall_outline(WallMeshBuilder *builder) {
+    const float radius = TILE_SIZE / 2.0f;
+
+    for (int y = 0; y < MAZE_HEIGHT; y++) {
+        for (int x = 0; x < MAZE_WIDTH; x++) {
+            if (get_tile(x, y) != WALL) continue;
+
+            float left = (float)(x * TILE_SIZE);
+            float top = (float)(y * TILE_SIZE);
+            float right = left + TILE_SIZE;
+            float bottom = top + TILE_SIZE;
+
+            bool wallUp = (get_tile(x, y - 1) == WALL);
+            bool wallDown = (get_tile(x, y + 1) == WALL);
+            bool wallLeft = (get_tile(x - 1, y) == WALL);
+            bool wallRight = (get_tile(x + 1, y) == WALL);
+
+            // Straight sides facing non-wall tiles, shortened where a corner arc takes over
+            float startX = wallLeft ? left : left + radius;
+            float endX = wallRight ? right : right - radius;
+            float startY = wallUp ? top : top + radius;
+            float endY = wallDown ? bottom : bottom - radius;
+
+            if (!wallUp)    add_segment(builder, (Vector2){ startX, top }, (Vector2){ endX, top });
+            if (!wallDown)  add_segment(builder, (Vector2){ startX, bottom }, (Vector2){ endX, bottom });
+            if (!wallLeft)  add_segment(builder, (Vector2){ left, startY }, (Vector2){ left, endY });
+            if (!wallRight) add_segment(builder, (Vector2){ right, startY }, (Vector2){ right, endY });
+
+            // Rounded corners for outer ends
+            if (!wallUp && !wallLeft)     add_arc(builder, (Vector2){ left + radius, top + radius }, radius, 2);
+            if (!wallUp && !wallRight)    add_arc(builder, (Vector2){ right - radius, top + radius }, radius, 3);
+            if (!wallDown && !wallLeft)   add_arc(builder, (Vector2){ left + radius, bottom - radius }, radius, 1);
+            if (!wallDown && !wallRight)  add_arc(builder, (Vector2){ right - radius, bottom - radius }, radius, 0);
+        }
+    }
+}
+
+// Maze Wall Mesh
+// ----------------------------------------------------------------------------------------
+Mesh GenMazeWallMesh(void) {
+    if (!arcTableReady) {
+        for (int i = 0; i <= WALL_ARC_SEGMENTS; i++) {
+            float angle = (PI / 2.0f) * i / WALL_ARC_SEGMENTS;
+            arcCos[i] = cosf(angle);
+            arcSin[i] = sinf(angle);
+        }
+        arcTableReady = true;
+    }
+
+    // First pass sizes the buffers
+    WallMeshBuilder builder = { 0 };
+    emit_wall_outline(&builder);
+    if (builder.vertexCount == 0) {
+        return (Mesh){ 0 };     // No walls loaded yet
+    }
+    if (builder.vertexCount > 65535) {
+        printf("Wall mesh has too many vertices for 16-bit indices (%d)\n", builder.vertexCount);
+        return (Mesh){ 0 };
+    }
+
+    // Second pass fills them. UnloadMesh frees these with RL_FREE, so allocate through raylib.
+    Mesh mesh = { 0 };
+    mesh.vertexCount = builder.vertexCount;
+    mesh.triangleCount = builder.indexCount / 3;
+    mesh.vertices = (float *)MemAlloc(builder.vertexCount * 3 * sizeof(float));
+    mesh.texcoords = (float *)MemAlloc(builder.vertexCount * 2 * sizeof(float));  // Zeroed, samples the default white texture
+    mesh.indices = (unsigned short *)MemAlloc(builder.indexCount * sizeof(unsigned short));
+
+    builder = (WallMeshBuilder){ mesh.vertices, mesh.indices, 0, 0 };
+    emit_wall_outline(&builder);
+    return mesh;
+}
+
+void BuildMazeWallMesh(void) {
+    UnloadMazeWallMesh();
+
+    wallMesh = GenMazeWallMesh();
+    if (wallMesh.vertexCount == 0) {
+        return;
+    }
+
+    UploadMesh(&wallMesh, false);   // Static vertex buffer
+    wallMaterial = LoadMaterialDefault();
+    wallMeshLoaded = true;
+}
+
+void DrawMazeWallMesh(int offsetX, int offsetY, Color color) {
+    if (!wallMeshLoaded) {
+        return;
+    }
+
+    wallMaterial.maps[MATERIAL_MAP_DIFFUSE].color = color;
+
+    rlDrawRenderBatchActive();      // Flush batched 2D draws so layering order is kept
+    rlDisableBackfaceCulling();     // The 2D projection flips Y, which reverses triangle winding
+    DrawMesh(wallMesh, wallMaterial, MatrixTranslate((float)offsetX, (float)offsetY, 0.0f));
+    rlEnableBackfaceCulling();
+}
+
+void UnloadMazeWallMesh(void) {
+    if (!wallMeshLoaded) {
+        return;
+    }
+    UnloadMesh(wallMesh);
+    UnloadMaterial(wallMaterial);
+    wallMesh = (Mesh){ 0 };
+    wallMaterial = (Material){ 0 };
+    wallMeshLoaded = false;
+}
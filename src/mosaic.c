@@ -0,0 +1,211 @@
+#include "mosaic.h"
+#include "frame_pacer.h"
+#include "game_logic.h"
+#include "render_commands.h"
+#include "rendering.h"
+#include "sprite_palette.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MOSAIC_TICK_TIME (1.0f / 60.0f)
+#define MOSAIC_LABEL_HEIGHT 12      // Pixels above each board for its label
+#define MOSAIC_HEADER_HEIGHT 24     // Pixels at the top of the window for the stats line
+
+typedef struct {
+    int boards;
+    unsigned int seed;
+} MosaicOptions;
+
+// Where the boards go in the window
+typedef struct {
+    int columns;
+    float cellWidth;
+    float cellHeight;
+    float scale;        // Maze pixels to window pixels
+} MosaicLayout;
+
+static GameSnapshot boards[MOSAIC_MAX_BOARDS];
+static int gamesPlayed[MOSAIC_MAX_BOARDS];
+
+static bool parse_options(int argc, char *argv[], MosaicOptions *options) {
+    *options = (MosaicOptions){ 16, 1 };
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--mosaic") == 0 && hasValue) {
+            options->boards = atoi(argv[++i]);
+        } else if (strcmp(arg, "--seed") == 0 && hasValue) {
+            options->seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "mosaic: unknown or incomplete option %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options->boards < 1 || options->boards > MOSAIC_MAX_BOARDS) {
+        fprintf(stderr, "mosaic: --mosaic must be between 1 and %d\n", MOSAIC_MAX_BOARDS);
+        return false;
+    }
+    return true;
+}
+
+// Picks the column count that gives the boards the largest scale in the window
+static MosaicLayout layout_boards(int boardCount) {
+    const float mazeWidth = MAZE_WIDTH * TILE_SIZE;
+    const float mazeHeight = MAZE_HEIGHT * TILE_SIZE;
+    float areaWidth = (float)GetScreenWidth();
+    float areaHeight = (float)(GetScreenHeight() - MOSAIC_HEADER_HEIGHT);
+
+    MosaicLayout best = { 1, areaWidth, areaHeight, 0.0f };
+    for (int columns = 1; columns <= boardCount; columns++) {
+        int rows = (boardCount + columns - 1) / columns;
+        float cellWidth = areaWidth / columns;
+        float cellHeight = areaHeight / rows;
+        float scale = fminf(cellWidth / mazeWidth, (cellHeight - MOSAIC_LABEL_HEIGHT) / mazeHeight);
+        if (scale > best.scale) {
+            best = (MosaicLayout){ columns, cellWidth, cellHeight, scale };
+        }
+    }
+    return best;
+}
+
+// Top-left corner of a board's maze in the window, centred in its cell under the label
+static Vector2 board_origin(const MosaicLayout *layout, int board) {
+    float mazeWidth = MAZE_WIDTH * TILE_SIZE * layout->scale;
+    float mazeHeight = MAZE_HEIGHT * TILE_SIZE * layout->scale;
+    float cellX = (board % layout->columns) * layout->cellWidth;
+    float cellY = MOSAIC_HEADER_HEIGHT + (board / layout->columns) * layout->cellHeight;
+    return (Vector2){ floorf(cellX + (layout->cellWidth - mazeWidth) / 2.0f),
+                      floorf(cellY + MOSAIC_LABEL_HEIGHT + (layout->cellHeight - MOSAIC_LABEL_HEIGHT - mazeHeight) / 2.0f) };
+}
+
+// Advances the game currently in the globals by one tick, restarting it once it is over
+static void tick_board(int board) {
+    simDeltaTime = MOSAIC_TICK_TIME;
+    if (gameState == STATE_PLAYING) {
+        steer_autopilot();
+    }
+
+    switch (step_gameplay()) {
+        case GAMEPLAY_GAME_OVER:
+            gamesPlayed[board] ++;
+            start_new_game();
+            break;
+        case GAMEPLAY_NEXT_LEVEL:
+            init_maze();
+            break;
+        default:
+            break;
+    }
+
+    // Nothing reads the journal here: boards draw their pellets straight from the bitboards
+    clear_tile_journal();
+}
+
+// Mosaic Viewer
+// ----------------------------------------------------------------------------------------
+bool is_mosaic_run(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--mosaic") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int run_mosaic(int argc, char *argv[]) {
+    MosaicOptions options;
+    if (!parse_options(argc, argv, &options)) {
+        return EXIT_FAILURE;
+    }
+
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, TextFormat("Pacman mosaic (%d boards)", options.boards));
+    InitFramePacer(FRAME_PACING_CAPPED);
+    SetRandomSeed(options.seed);
+    LoadGhostTextures(ghosts);
+    LoadSpritePalette();
+
+    // One game per board, each with its own simulation random stream
+    for (int i = 0; i < options.boards; i++) {
+        simRandomState = options.seed + (unsigned int)i;
+        start_new_game();
+        capture_game_snapshot(&boards[i]);
+        gamesPlayed[i] = 0;
+    }
+
+    // Every board has the same walls, so the wall layer is built once and never refreshed: restoring
+    // a snapshot bumps mazeVersion, but the walls it would rebuild are identical
+    RefreshMazeTextures();
+
+    double simMs = 0.0;
+    double drawMs = 0.0;
+    while (!WindowShouldClose()) {
+        MosaicLayout layout = layout_boards(options.boards);
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+
+        // All walls first, from the one shared texture, so they go out as a single batch
+        for (int i = 0; i < options.boards; i++) {
+            Vector2 origin = board_origin(&layout, i);
+            rlPushMatrix();
+            rlTranslatef(origin.x, origin.y, 0.0f);
+            rlScalef(layout.scale, layout.scale, 1.0f);
+            DrawMazeWallLayer(0, 0);
+            rlPopMatrix();
+        }
+
+        // Then each board in turn: swap its game into the globals, tick it, draw it, swap it out.
+        // The transform is applied per vertex by rlgl, so moving between boards does not flush.
+        double simTime = 0.0;
+        double drawTime = 0.0;
+        for (int i = 0; i < options.boards; i++) {
+            double start = GetTime();
+            restore_game_snapshot(&boards[i]);
+            tick_board(i);
+            capture_game_snapshot(&boards[i]);
+            double ticked = GetTime();
+
+            Vector2 origin = board_origin(&layout, i);
+            BeginRenderCommands();
+            render_board(0, 0);
+            rlPushMatrix();
+            rlTranslatef(origin.x, origin.y, 0.0f);
+            rlScalef(layout.scale, layout.scale, 1.0f);
+            SubmitRenderCommands(RENDER_BACKEND_RAYLIB);
+            rlPopMatrix();
+
+            simTime += ticked - start;
+            drawTime += GetTime() - ticked;
+        }
+
+        // Labels last, all from the default font's texture
+        for (int i = 0; i < options.boards; i++) {
+            Vector2 origin = board_origin(&layout, i);
+            DrawText(TextFormat("#%d L%d %d G%d", i + 1, boards[i].level, boards[i].pacman.score, gamesPlayed[i]),
+                     (int)origin.x, (int)origin.y - MOSAIC_LABEL_HEIGHT, 10, GRAY);
+        }
+
+        // Smoothed, so the numbers can be read
+        simMs += (simTime * 1000.0 - simMs) * 0.05;
+        drawMs += (drawTime * 1000.0 - drawMs) * 0.05;
+        FrameTimeStats frameStats = GetFrameTimeStats();
+        DrawText(TextFormat("%d BOARDS  FPS %d  SIM %.2f MS  DRAW %.2f MS  FRAME P99 %.2f MS",
+                            options.boards, GetFPS(), simMs, drawMs, frameStats.p99Ms),
+                 10, 6, 10, GREEN);
+
+        EndDrawing();
+        WaitForNextFrame();
+    }
+
+    UnloadMazeTextures();
+    UnloadGhostTextures(ghosts);
+    UnloadSpritePalette();
+    CloseWindow();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+#include "post_process.h"
+#include "rlgl.h"
+#include <math.h>
+
+// Shader source header for the OpenGL version raylib is built against
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3)
+    #define CRT_SHADER_HEADER "#version 100\n" "precision mediump float;\n" \
+                              "#define IN varying\n" "#define TEX texture2D\n" "#define finalColor gl_FragColor\n"
+#elif defined(GRAPHICS_API_OPENGL_21)
+    #define CRT_SHADER_HEADER "#version 120\n" \
+                              "#define IN varying\n" "#define TEX texture2D\n" "#define finalColor gl_FragColor\n"
+#else
+    #define CRT_SHADER_HEADER "#version 330\n" \
+                              "#define IN in\n" "#define TEX texture\n" "out vec4 finalColor;\n"
+#endif
+
+// Scanlines, vignette, glow and grain in one pass
+static const char *crtFragmentShader = CRT_SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 resolution;\n"
+    "uniform float scanlines;\n"
+    "uniform float vignette;\n"
+    "uniform float glow;\n"
+    "uniform float noise;\n"
+    "uniform float time;\n"
+    "void main() {\n"
+    "    vec2 uv = fragTexCoord;\n"
+    "    vec3 color = TEX(texture0, uv).rgb;\n"
+    "    if (glow > 0.0) {\n"
+    "        vec2 px = 2.0 / resolution;\n"
+    "        vec3 blur = TEX(texture0, uv + vec2(px.x, 0.0)).rgb + TEX(texture0, uv - vec2(px.x, 0.0)).rgb +\n"
+    "                    TEX(texture0, uv + vec2(0.0, px.y)).rgb + TEX(texture0, uv - vec2(0.0, px.y)).rgb;\n"
+    "        color += blur * 0.25 * glow;\n"
+    "    }\n"
+    "    if (mod(floor(uv.y * resolution.y), 4.0) < 2.0) color *= 1.0 - scanlines;\n"
+    "    color *= 1.0 - vignette * smoothstep(0.3, 0.8, length(uv - 0.5));\n"
+    "    float grain = fract(sin(dot(uv * resolution + time, vec2(12.9898, 78.233))) * 43758.5453);\n"
+    "    color += (grain - 0.5) * noise;\n"
+    "    finalColor = vec4(color, 1.0) * colDiffuse * fragColor;\n"
+    "}\n";
+
+// Effects per screen, indexed by GameState
+static const PostProcessSettings screenSettings[] = {
+    [STATE_PERSONAL_LOGO]  = { 0.20f, 0.35f, 0.00f, 0.02f },
+    [STATE_RAYLIB_LOGO]    = { 0.00f, 0.00f, 0.00f, 0.00f },   // raylib's own branding, left untouched
+    [STATE_LOGO]           = { 0.20f, 0.35f, 0.10f, 0.02f },
+    [STATE_MENU]           = { 0.20f, 0.35f, 0.10f, 0.02f },
+    [STATE_HIGHSCORES]     = { 0.20f, 0.35f, 0.00f, 0.02f },
+    [STATE_ABOUT]          = { 0.20f, 0.35f, 0.00f, 0.02f },
+    [STATE_SETTINGS]       = { 0.20f, 0.35f, 0.00f, 0.02f },
+    [STATE_READY]          = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_PLAYING]        = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_PAUSED]         = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_DEATH_ANIM]     = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_GHOST_EATEN]    = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_LEVEL_COMPLETE] = { 0.10f, 0.25f, 0.15f, 0.00f },
+    [STATE_GAME_OVER]      = { 0.20f, 0.35f, 0.00f, 0.02f },
+};
+
+static Shader crtShader = { 0 };
+static bool shaderLoaded = false;
+static bool postProcessEnabled = true;
+static RenderTexture2D sceneTarget = { 0 };   // Virtual screen, SCREEN_WIDTH x SCREEN_HEIGHT
+static bool drawingToTarget = false;           // Whether the current frame goes through the virtual screen
+static bool applyShader = false;               // Whether the current frame goes through the shader
+static PostProcessSettings frameSettings = { 0 };
+
+static int resolutionLoc, scanlinesLoc, vignetteLoc, glowLoc, noiseLoc, timeLoc;
+
+// Post Processing
+// ----------------------------------------------------------------------------------------
+void InitPostProcess(void) {
+    sceneTarget = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+    SetTextureFilter(sceneTarget.texture, TEXTURE_FILTER_POINT);     // Sharp pixels when scaled up
+    if (sceneTarget.id == 0) {
+        printf("Virtual screen unavailable, drawing straight to the window\n");
+    }
+
+    crtShader = LoadShaderFromMemory(NULL, crtFragmentShader);
+    shaderLoaded = crtShader.id != 0 && crtShader.id != rlGetShaderIdDefault();     // Falls back to the default shader on failure
+    if (!shaderLoaded) {
+        printf("CRT shader unavailable, post processing disabled\n");
+        return;
+    }
+
+    resolutionLoc = GetShaderLocation(crtShader, "resolution");
+    scanlinesLoc = GetShaderLocation(crtShader, "scanlines");
+    vignetteLoc = GetShaderLocation(crtShader, "vignette");
+    glowLoc = GetShaderLocation(crtShader, "glow");
+    noiseLoc = GetShaderLocation(crtShader, "noise");
+    timeLoc = GetShaderLocation(crtShader, "time");
+}
+
+void UnloadPostProcess(void) {
+    if (sceneTarget.id != 0) {
+        UnloadRenderTexture(sceneTarget);
+        sceneTarget = (RenderTexture2D){ 0 };
+    }
+    if (shaderLoaded) {
+        UnloadShader(crtShader);
+        shaderLoaded = false;
+    }
+}
+
+void TogglePostProcess(void) {
+    postProcessEnabled = !postProcessEnabled;
+}
+
+void BeginPostProcess(GameState state) {
+    frameSettings = screenSettings[state];
+    bool anyEffect = frameSettings.scanlines > 0.0f || frameSettings.vignette > 0.0f ||
+                     frameSettings.glow > 0.0f || frameSettings.noise > 0.0f;
+    drawingToTarget = sceneTarget.id != 0;
+    applyShader = drawingToTarget && shaderLoaded && postProcessEnabled && anyEffect;
+
+    if (!drawingToTarget) {
+        BeginDrawing();
+        return;
+    }
+    BeginTextureMode(sceneTarget);
+}
+
+void EndPostProcess(Rectangle screenRect) {
+    if (!drawingToTarget) {
+        return;     // Already drawing to the window
+    }
+    EndTextureMode();
+
+    Vector2 resolution = { (float)sceneTarget.texture.width, (float)sceneTarget.texture.height };
+    if (applyShader) {
+        float time = (float)GetTime();
+        SetShaderValue(crtShader, resolutionLoc, &resolution, SHADER_UNIFORM_VEC2);
+        SetShaderValue(crtShader, scanlinesLoc, &frameSettings.scanlines, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(crtShader, vignetteLoc, &frameSettings.vignette, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(crtShader, glowLoc, &frameSettings.glow, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(crtShader, noiseLoc, &frameSettings.noise, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(crtShader, timeLoc, &time, SHADER_UNIFORM_FLOAT);
+    }
+
+    BeginDrawing();
+    ClearBackground(BLACK);     // Letterbox bars
+    if (applyShader) BeginShaderMode(crtShader);
+    DrawTexturePro(sceneTarget.texture,
+                   (Rectangle){ 0, 0, resolution.x, -resolution.y },     // Render textures are stored upside down
+                   screenRect, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    if (applyShader) EndShaderMode();
+}
+
+Rectangle GetVirtualScreenRect(void) {
+    float windowWidth = (float)GetScreenWidth();
+    float windowHeight = (float)GetScreenHeight();
+    if (sceneTarget.id == 0) {
+        return (Rectangle){ 0, 0, windowWidth, windowHeight };
+    }
+
+    // Whole multiples keep every virtual pixel the same size; only a window smaller than
+    // the virtual screen falls back to a fractional downscale
+    float scale = fminf(windowWidth / SCREEN_WIDTH, windowHeight / SCREEN_HEIGHT);
+    if (scale >= 1.0f) {
+        scale = floorf(scale);
+    }
+    float width = SCREEN_WIDTH * scale;
+    float height = SCREEN_HEIGHT * scale;
+    return (Rectangle){ floorf((windowWidth - width) / 2.0f), floorf((windowHeight - height) / 2.0f), width, height };
+}
+
+Vector2 GetVirtualScreenSize(void) {
+    if (sceneTarget.id == 0) {
+        return (Vector2){ (float)GetScreenWidth(), (float)GetScreenHeight() };
+    }
+    return (Vector2){ (float)sceneTarget.texture.width, (float)sceneTarget.texture.height };
+}
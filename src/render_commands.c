@@ -0,0 +1,300 @@
+#include "render_commands.h"
+#include "rendering.h"
+#include "soft_render.h"
+#include "sprite_batch.h"
+#include "sprite_palette.h"
+#include <math.h>
+#include <string.h>
+
+static RenderCommand commands[RENDER_COMMAND_CAPACITY];
+static int commandCount = 0;
+static char textArena[RENDER_TEXT_ARENA_SIZE];
+static int textArenaUsed = 0;
+static int droppedCount = 0;
+
+static RenderCommandStats lastStats = { 0 };
+static unsigned int lastHash = 0;
+static RenderBackend lastBackend = RENDER_BACKEND_NULL;
+static bool softwareFrameValid = false;     // The CPU frame holds the last software submission
+
+// Returns a zeroed slot (so hashing never sees stale padding), or NULL when the frame is full
+static RenderCommand *push_command(RenderCommandType type, Color color) {
+    if (commandCount == RENDER_COMMAND_CAPACITY) {
+        droppedCount ++;
+        return NULL;
+    }
+    RenderCommand *command = &commands[commandCount ++];
+    memset(command, 0, sizeof(*command));
+    command->type = type;
+    command->color = color;
+    return command;
+}
+
+// FNV-1a over the commands and the text they reference
+static unsigned int hash_commands(void) {
+    unsigned int hash = 2166136261u;
+    const unsigned char *bytes = (const unsigned char *)commands;
+    for (size_t i = 0; i < commandCount * sizeof(RenderCommand); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    for (int i = 0; i < textArenaUsed; i++) {
+        hash = (hash ^ (unsigned char)textArena[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Stable insertion sort of each run of consecutive sprites by texture
+static void sort_sprite_runs(void) {
+    int runStart = 0;
+    while (runStart < commandCount) {
+        if (commands[runStart].type != RENDER_CMD_SPRITE) {
+            runStart ++;
+            continue;
+        }
+        int runEnd = runStart;
+        while (runEnd < commandCount && commands[runEnd].type == RENDER_CMD_SPRITE) runEnd ++;
+
+        for (int i = runStart + 1; i < runEnd; i++) {
+            RenderCommand command = commands[i];
+            int j = i - 1;
+            while (j >= runStart && commands[j].sprite.texture.id > command.sprite.texture.id) {
+                commands[j + 1] = commands[j];
+                j --;
+            }
+            commands[j + 1] = command;
+        }
+        runStart = runEnd;
+    }
+}
+
+// Backends
+// ----------------------------------------------------------------------------------------
+static void submit_raylib(void) {
+    SpriteBatchBegin();
+    for (int i = 0; i < commandCount; i++) {
+        const RenderCommand *c = &commands[i];
+        if (c->type == RENDER_CMD_SPRITE) {
+            SpriteBatchDraw(c->sprite.texture, c->sprite.source, c->sprite.dest, c->sprite.origin, c->sprite.rotation, c->color);
+            continue;
+        }
+
+        SpriteBatchFlush();     // Keep the queued sprites under whatever comes next
+        switch (c->type) {
+            case RENDER_CMD_CLEAR:        ClearBackground(c->color); break;
+            case RENDER_CMD_RECT:         DrawRectangleRec(c->rect, c->color); break;
+            case RENDER_CMD_CIRCLE:       DrawCircleV(c->circle.center, c->circle.radius, c->color); break;
+            case RENDER_CMD_LINE:         DrawLineEx(c->line.start, c->line.end, c->line.thickness, c->color); break;
+            case RENDER_CMD_ARC:
+                DrawArc(c->arc.center, c->arc.radius, c->arc.startAngle, c->arc.endAngle, c->arc.segments, c->arc.thickness, c->color);
+                break;
+            case RENDER_CMD_TEXT:
+                DrawTextEx(*c->text.font, c->text.text, c->text.position, c->text.fontSize, c->text.spacing, c->color);
+                break;
+            case RENDER_CMD_MAZE_PELLETS: DrawMazePelletLayer(c->maze.offsetX, c->maze.offsetY); break;
+            case RENDER_CMD_MAZE_WALLS:   DrawMazeWallLayer(c->maze.offsetX, c->maze.offsetY); break;
+            case RENDER_CMD_PALETTE_TIME: SetSpritePaletteTime(c->time); break;
+            case RENDER_CMD_HUD:          DrawHudLayer(); break;
+            default: break;
+        }
+    }
+    SpriteBatchEnd();
+}
+
+// Thick line as a quad of two triangles
+static void soft_line(Vector2 start, Vector2 end, float thickness, Color color) {
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f) return;
+    float nx = -dy / length * (thickness / 2.0f);
+    float ny = dx / length * (thickness / 2.0f);
+
+    Vector2 a = { start.x + nx, start.y + ny };
+    Vector2 b = { start.x - nx, start.y - ny };
+    Vector2 c = { end.x + nx, end.y + ny };
+    Vector2 d = { end.x - nx, end.y - ny };
+    SoftDrawTriangle(a, b, c, color);
+    SoftDrawTriangle(b, d, c, color);
+}
+
+// Thick arc as a strip of quads, tessellated like DrawArc
+static void soft_arc(Vector2 center, float radius, float startAngle, float endAngle, int segments, float thickness, Color color) {
+    if (segments <= 0) return;
+    float inner = radius - thickness / 2.0f;
+    float outer = radius + thickness / 2.0f;
+    float step = (endAngle - startAngle) * DEG2RAD / segments;
+    float angle = startAngle * DEG2RAD;
+
+    for (int i = 0; i < segments; i++, angle += step) {
+        Vector2 a = { center.x + cosf(angle) * inner, center.y + sinf(angle) * inner };
+        Vector2 b = { center.x + cosf(angle) * outer, center.y + sinf(angle) * outer };
+        Vector2 c = { center.x + cosf(angle + step) * inner, center.y + sinf(angle + step) * inner };
+        Vector2 d = { center.x + cosf(angle + step) * outer, center.y + sinf(angle + step) * outer };
+        SoftDrawTriangle(a, b, c, color);
+        SoftDrawTriangle(b, d, c, color);
+    }
+}
+
+static void submit_software(void) {
+    for (int i = 0; i < commandCount; i++) {
+        const RenderCommand *c = &commands[i];
+        switch (c->type) {
+            case RENDER_CMD_CLEAR:        SoftClear(c->color); break;
+            case RENDER_CMD_SPRITE:       SoftDrawSprite(c->sprite.source, c->sprite.dest, c->sprite.origin, c->color); break;
+            case RENDER_CMD_RECT:
+                SoftDrawRectangle((int)c->rect.x, (int)c->rect.y, (int)c->rect.width, (int)c->rect.height, c->color);
+                break;
+            case RENDER_CMD_CIRCLE:
+                SoftDrawCircle((int)c->circle.center.x, (int)c->circle.center.y, (int)c->circle.radius, c->color);
+                break;
+            case RENDER_CMD_LINE:         soft_line(c->line.start, c->line.end, c->line.thickness, c->color); break;
+            case RENDER_CMD_ARC:
+                soft_arc(c->arc.center, c->arc.radius, c->arc.startAngle, c->arc.endAngle, c->arc.segments, c->arc.thickness, c->color);
+                break;
+            case RENDER_CMD_MAZE_PELLETS: SoftDrawMazePellets(c->maze.offsetX, c->maze.offsetY); break;
+            case RENDER_CMD_MAZE_WALLS:   SoftDrawMazeWalls(c->maze.offsetX, c->maze.offsetY); break;
+            case RENDER_CMD_PALETTE_TIME: SetSpritePaletteTime(c->time); break;
+            case RENDER_CMD_HUD:
+                SoftDrawHudIcons(c->hud.livesX, c->hud.fruitsX, c->hud.y, c->hud.lives, c->hud.fruits);
+                break;
+            default: break;     // Text: raylib draws it only from a font's GPU texture
+        }
+    }
+}
+
+// Render Commands
+// ----------------------------------------------------------------------------------------
+void BeginRenderCommands(void) {
+    commandCount = 0;
+    textArenaUsed = 0;
+    droppedCount = 0;
+}
+
+void PushClearCommand(Color color) {
+    push_command(RENDER_CMD_CLEAR, color);
+}
+
+void PushSpriteCommand(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    RenderCommand *command = push_command(RENDER_CMD_SPRITE, tint);
+    if (command) {
+        command->sprite.texture = texture;
+        command->sprite.source = source;
+        command->sprite.dest = dest;
+        command->sprite.origin = origin;
+        command->sprite.rotation = rotation;
+    }
+}
+
+void PushRectCommand(Rectangle rect, Color color) {
+    RenderCommand *command = push_command(RENDER_CMD_RECT, color);
+    if (command) {
+        command->rect = rect;
+    }
+}
+
+void PushCircleCommand(Vector2 center, float radius, Color color) {
+    RenderCommand *command = push_command(RENDER_CMD_CIRCLE, color);
+    if (command) {
+        command->circle.center = center;
+        command->circle.radius = radius;
+    }
+}
+
+void PushLineCommand(Vector2 start, Vector2 end, float thickness, Color color) {
+    RenderCommand *command = push_command(RENDER_CMD_LINE, color);
+    if (command) {
+        command->line.start = start;
+        command->line.end = end;
+        command->line.thickness = thickness;
+    }
+}
+
+void PushArcCommand(Vector2 center, float radius, float startAngle, float endAngle, int segments, float thickness, Color color) {
+    RenderCommand *command = push_command(RENDER_CMD_ARC, color);
+    if (command) {
+        command->arc.center = center;
+        command->arc.radius = radius;
+        command->arc.startAngle = startAngle;
+        command->arc.endAngle = endAngle;
+        command->arc.segments = segments;
+        command->arc.thickness = thickness;
+    }
+}
+
+void PushTextCommand(const Font *font, const char *text, Vector2 position, float fontSize, float spacing, Color color) {
+    int length = (int)strlen(text) + 1;
+    if (textArenaUsed + length > RENDER_TEXT_ARENA_SIZE) {
+        droppedCount ++;
+        return;
+    }
+    RenderCommand *command = push_command(RENDER_CMD_TEXT, color);
+    if (command) {
+        char *copy = &textArena[textArenaUsed];
+        memcpy(copy, text, length);
+        textArenaUsed += length;
+
+        command->text.font = font;
+        command->text.text = copy;
+        command->text.position = position;
+        command->text.fontSize = fontSize;
+        command->text.spacing = spacing;
+    }
+}
+
+void PushMazeCommand(RenderCommandType type, int offsetX, int offsetY, int version, int pellets) {
+    RenderCommand *command = push_command(type, WHITE);
+    if (command) {
+        command->maze.offsetX = offsetX;
+        command->maze.offsetY = offsetY;
+        command->maze.version = version;
+        command->maze.pellets = pellets;
+    }
+}
+
+void PushPaletteTimeCommand(float time) {
+    RenderCommand *command = push_command(RENDER_CMD_PALETTE_TIME, WHITE);
+    if (command) {
+        command->time = time;
+    }
+}
+
+void PushHudCommand(float livesX, float fruitsX, float y, int lives, int fruits, int score) {
+    RenderCommand *command = push_command(RENDER_CMD_HUD, WHITE);
+    if (command) {
+        command->hud.livesX = livesX;
+        command->hud.fruitsX = fruitsX;
+        command->hud.y = y;
+        command->hud.lives = lives;
+        command->hud.fruits = fruits;
+        command->hud.score = score;
+    }
+}
+
+void SubmitRenderCommands(RenderBackend backend) {
+    sort_sprite_runs();
+
+    unsigned int hash = hash_commands();
+    bool unchanged = (hash == lastHash && backend == lastBackend);
+    lastHash = hash;
+    lastBackend = backend;
+
+    switch (backend) {
+        case RENDER_BACKEND_RAYLIB:
+            submit_raylib();    // The target is cleared every frame, so it always redraws
+            break;
+        case RENDER_BACKEND_SOFTWARE:
+            if (!(unchanged && softwareFrameValid)) {
+                submit_software();
+                softwareFrameValid = true;
+            }
+            break;
+        default:
+            break;
+    }
+
+    lastStats = (RenderCommandStats){ commandCount, textArenaUsed, droppedCount, unchanged };
+}
+
+RenderCommandStats GetRenderCommandStats(void) {
+    return lastStats;
+}
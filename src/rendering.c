@@ -1,22 +1,19 @@
 #include "rendering.h"
+#include "maze_mesh.h"
+#include "render_commands.h"
+#include "sprite_atlas.h"
+#include "sprite_frames.h"
+#include "sprite_palette.h"
+#include "rlgl.h"
+
+WallRenderMode wallRenderMode = WALL_RENDER_TEXTURE;
 
 // Texture Management
 // ----------------------------------------------------------------------------------------
 // Loads ghost textures and assigns them to the ghost array, also setting Pac-Man and fruit sprites.
 void LoadGhostTextures(Ghost *ghostArray) {
-    // Load the sprite sheet as an image
-    Image spriteImage = LoadImage("assets/sprites/pacman_general_sprites.png");
-
-    // Replace black (RGB 0,0,0) with transparent (RGBA 0,0,0,0)
-    Color black = { 0, 0, 0, 255 };         // Black color (opaque)
-    Color transparent = { 0, 0, 0, 0 };     // Transparent color
-    ImageColorReplace(&spriteImage, black, transparent);
-
-    // Convert the modified image to a texture
-    spriteSheet = LoadTextureFromImage(spriteImage);
-
-    // Unload the image
-    UnloadImage(spriteImage);
+    // Load the pre-baked atlas (transparent, premultiplied, with pre-rotated Pac-Man frames)
+    spriteSheet = LoadSpriteAtlas();
 
     // Assign Pac-Man sprite
     pacman.sprite = spriteSheet;
@@ -40,6 +37,121 @@ void UnloadGhostTextures(Ghost *ghostArray) {
     UnloadTexture(spriteSheet);
 }
 
+// Maze walls only change when a level is loaded, so they are rasterised once into this layer
+static RenderTexture2D wallLayer = { 0 };
+static int wallLayerVersion = -1;     // mazeVersion the layer was last built from
+
+// Pellets, power pellets and the ghost gate, patched tile by tile from the tile journal as pellets are eaten
+static RenderTexture2D pelletLayer = { 0 };
+static int pelletLayerVersion = -1;   // mazeVersion the layer was last fully built from
+
+// What the HUD shows; the HUD layer is only redrawn when this changes
+typedef struct {
+    int score;
+    int highScore;
+    int level;
+    int lives;
+    int fruits;
+} HudContents;
+
+// Labels and icons around the maze, covering the whole screen
+static RenderTexture2D hudLayer = { 0 };
+static HudContents hudLayerContents = { 0 };
+static GameplayLayout hudLayerLayout = { 0 };   // Layout the layer was drawn for
+
+static void draw_maze_walls(int offsetX, int offsetY);
+
+// Draws the contents of one tile into the pellet layer. Power pellets are drawn in
+// POWER_PELLET_COLOR, which the palette shader blinks when the layer is drawn.
+static void draw_pellet_layer_tile(int x, int y) {
+    int posX = x * TILE_SIZE;
+    int posY = y * TILE_SIZE;
+
+    switch (get_tile(x, y)) {
+        case PELLET:
+            DrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 2, YELLOW); // Smaller pellets
+            break;
+        case POWER_PELLET:
+            DrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 5, POWER_PELLET_COLOR); // Larger power pellets
+            break;
+        case GHOST_GATE:
+            DrawRectangle(posX, posY + TILE_SIZE / 2 - 2, TILE_SIZE, 4, WHITE); // Horizontal gate
+            break;
+        default:
+            break;
+    }
+}
+
+// Brings the pellet layer up to date: a full redraw after a maze reload or journal overflow,
+// otherwise only the tiles that changed since the last frame.
+static void refresh_pellet_layer(void) {
+    if (pelletLayer.id == 0) {
+        pelletLayer = LoadRenderTexture(MAZE_WIDTH * TILE_SIZE, MAZE_HEIGHT * TILE_SIZE);
+        pelletLayerVersion = -1;
+    }
+
+    BeginTextureMode(pelletLayer);
+    if (pelletLayerVersion != mazeVersion || tileJournal.overflowed) {
+        ClearBackground(BLANK);
+        for (int y = 0; y < MAZE_HEIGHT; y++) {
+            for (int x = 0; x < MAZE_WIDTH; x++) {
+                draw_pellet_layer_tile(x, y);
+            }
+        }
+        pelletLayerVersion = mazeVersion;
+    } else {
+        for (int i = 0; i < tileJournal.count; i++) {
+            TileChange change = tileJournal.changes[i];
+
+            // Erase just this tile, then redraw whatever it holds now
+            BeginScissorMode(change.x * TILE_SIZE, change.y * TILE_SIZE, TILE_SIZE, TILE_SIZE);
+            ClearBackground(BLANK);
+            EndScissorMode();
+            draw_pellet_layer_tile(change.x, change.y);
+        }
+    }
+    EndTextureMode();
+}
+
+// Rebuilds the cached wall layer if the maze has been reloaded since it was last drawn,
+// and applies this frame's tile changes to the pellet layer.
+void RefreshMazeTextures(void) {
+    refresh_pellet_layer();
+
+    if (wallLayerVersion == mazeVersion) {
+        return;
+    }
+
+    if (wallLayer.id == 0) {
+        // One extra pixel so the outline on the right and bottom edges is not clipped
+        wallLayer = LoadRenderTexture(MAZE_WIDTH * TILE_SIZE + 1, MAZE_HEIGHT * TILE_SIZE + 1);
+    }
+
+    BeginTextureMode(wallLayer);
+    ClearBackground(BLANK);
+    draw_maze_walls(0, 0);
+    EndTextureMode();
+
+    BuildMazeWallMesh();
+
+    wallLayerVersion = mazeVersion;
+}
+
+// Unloads the cached maze layers.
+void UnloadMazeTextures(void) {
+    if (wallLayer.id != 0) {
+        UnloadRenderTexture(wallLayer);
+        wallLayer = (RenderTexture2D){ 0 };
+    }
+    if (pelletLayer.id != 0) {
+        UnloadRenderTexture(pelletLayer);
+        pelletLayer = (RenderTexture2D){ 0 };
+    }
+    UnloadMazeWallMesh();
+    wallLayerVersion = -1;
+    pelletLayerVersion = -1;
+}
+
 // Utility Functions
 // ----------------------------------------------------------------------------------------
 // Draws an arc for maze wall corners, used in render_maze.
@@ -68,57 +180,24 @@ void DrawArc(Vector2 center, float radius, float startAngle, float endAngle, int
     }
 }
 
-// Rendering Functions
-// ----------------------------------------------------------------------------------------
-// Renders the maze, including walls, pellets, power pellets, ghost gate, and active fruit.
-void render_maze(int offsetX, int offsetY) {
-    // Update global blink timer
-    blinkTimer += GetFrameTime();
-    if (blinkTimer >= 1.0f) { // Reset every 1 second (0.5s on, 0.5s off)
-        blinkTimer = 0.0f;
-    }
-    bool powerPelletVisible = (blinkTimer < 0.5f); // Visible for first 0.5 seconds
-
-    // First pass: Draw pellets, power pellets, and ghost gate
-    for (int y = 0; y < MAZE_HEIGHT; y++) {
-        for (int x = 0; x < MAZE_WIDTH; x++) {
-            int posX = offsetX + x * TILE_SIZE;
-            int posY = offsetY + y * TILE_SIZE;
-
-            switch (maze[y][x]) {
-                case PELLET:
-                    DrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 2, YELLOW); // Smaller pellets
-                    break;
-                case POWER_PELLET:
-                    if (powerPelletVisible) {
-                        DrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 5, ORANGE); // Larger power pellets
-                    }
-                    break;
-                case GHOST_GATE:
-                    DrawRectangle(posX, posY + TILE_SIZE / 2 - 2, TILE_SIZE, 4, WHITE); // Horizontal gate
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
-
-    // Second pass: Draw walls as single outlines with curved corners
+// Draws the maze walls as single outlines with curved corners.
+// Only called when the wall layer is rebuilt, never per frame.
+static void draw_maze_walls(int offsetX, int offsetY) {
     const int lineThickness = 1;
-    const Color wallColor = { 0, 120, 215, 255 }; // Light Blue
+    const Color wallColor = MAZE_WALL_COLOR;
 
     for (int y = 0; y < MAZE_HEIGHT; y++) {
         for (int x = 0; x < MAZE_WIDTH; x++) {
-            if (maze[y][x] != WALL) continue;
+            if (get_tile(x, y) != WALL) continue;
 
             int pixelX = offsetX + x * TILE_SIZE;
             int pixelY = offsetY + y * TILE_SIZE;
 
             // Check neighboring tiles to determine wall connections
-            bool up = (y > 0 && maze[y - 1][x] == WALL);
-            bool down = (y < MAZE_HEIGHT - 1 && maze[y + 1][x] == WALL);
-            bool left = (x > 0 && maze[y][x - 1] == WALL);
-            bool right = (x < MAZE_WIDTH - 1 && maze[y][x + 1] == WALL);
+            bool up = (get_tile(x, y - 1) == WALL);
+            bool down = (get_tile(x, y + 1) == WALL);
+            bool left = (get_tile(x - 1, y) == WALL);
+            bool right = (get_tile(x + 1, y) == WALL);
 
             float outerRadius = TILE_SIZE / 2.0f; // Radius for outer arcs
 
@@ -185,43 +264,141 @@ void render_maze(int offsetX, int offsetY) {
             }
         }
     }
+}
 
-    // Render fruit if active
-    if (fruit.active) {
-        //printf("Rendering fruit at gridX: %d, gridY: %d\n", fruit.gridX, fruit.gridY);
-        float scaleFactor = (float)TILE_SIZE / 16.0f;
-        float scaledWidth = 16.0f * scaleFactor;
-        float scaledHeight = 16.0f * scaleFactor;
-        Rectangle sourceRec = { 35.0f, 48.0f, 16.0f, 16.0f };
+// Draws the cached pellet layer through the palette shader, which blinks the power pellets.
+void DrawMazePelletLayer(int offsetX, int offsetY) {
+    Color tint = IsSpritePaletteReady() ? GetSpritePaletteTint(SPRITE_PALETTE_POWER_PELLETS, 0.0f) : WHITE;
+    BeginSpritePalette();
+    DrawTextureRec(pelletLayer.texture,
+                   (Rectangle){ 0, 0, (float)pelletLayer.texture.width, -(float)pelletLayer.texture.height },
+                   (Vector2){ (float)offsetX, (float)offsetY }, tint);
+    EndSpritePalette();
+}
 
-        float tileCenterX = fruit.gridX * TILE_SIZE + offsetX + (TILE_SIZE / 2.0f);
-        float tileCenterY = fruit.gridY * TILE_SIZE + offsetY + (TILE_SIZE / 2.0f);
+// Draws the prebuilt walls in the current wall render mode.
+void DrawMazeWallLayer(int offsetX, int offsetY) {
+    if (wallRenderMode == WALL_RENDER_MESH) {
+        DrawMazeWallMesh(offsetX, offsetY, MAZE_WALL_COLOR);
+    } else {
+        DrawTextureRec(wallLayer.texture,
+                       (Rectangle){ 0, 0, (float)wallLayer.texture.width, -(float)wallLayer.texture.height },  // Render textures are stored upside down
+                       (Vector2){ (float)offsetX, (float)offsetY }, WHITE);
+    }
+}
 
-        // Position the sprite so its center is at the tile's center
-        Rectangle destRec = {
-            tileCenterX - (scaledWidth / 2.0f),  // Top-left x
-            tileCenterY - (scaledHeight / 2.0f), // Top-left y
-            scaledWidth,
-            scaledHeight
-        };
-        Vector2 origin = { 0.0f, 0.0f }; // Origin at top-left for precise positioning
-        DrawTexturePro(fruit.sprite, sourceRec, destRec, origin, 0.0f, WHITE); 
-    }  
+// Draws one row of 16px HUD icons scaled to a tile, 5px apart
+static void draw_hud_icons(Texture2D texture, Rectangle source, float startX, float y, int count) {
+    float size = (float)TILE_SIZE;
+    Vector2 origin = { size / 2.0f, size / 2.0f };
+    for (int i = 0; i < count; i++) {
+        DrawTexturePro(texture, source, (Rectangle){ startX + i * (size + 5), y, size, size }, origin, 0.0f, WHITE);
+    }
+}
+
+// Redraws the HUD layer when the score, high score, level, lives or fruit count has changed, or the layout has.
+void RefreshHudLayer(const Font *font, const GameplayLayout *layout) {
+    HudContents contents = { pacman.score, highscores[0].score, level, pacman.lives, totalFruitsCollected };
+    bool sameLayout = memcmp(layout, &hudLayerLayout, sizeof(GameplayLayout)) == 0;
+    if (hudLayer.id != 0 && sameLayout && memcmp(&contents, &hudLayerContents, sizeof(HudContents)) == 0) {
+        return;
+    }
+
+    if (hudLayer.id == 0 || !sameLayout) {
+        UnloadHudLayer();
+        hudLayer = LoadRenderTexture(layout->screenWidth, layout->screenHeight);
+        if (hudLayer.id == 0) {
+            return;
+        }
+    }
+
+    // The layer holds premultiplied colour, like the atlas. The font's glyphs are straight alpha, so
+    // they are blended with their colour scaled by alpha but their alpha kept as is
+    BeginTextureMode(hudLayer);
+    ClearBackground(BLANK);
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    DrawTextEx(*font, "Score: ", layout->scoreLabel, 16.0f, 1, WHITE);
+    DrawTextEx(*font, TextFormat("%d", contents.score), layout->scoreValue, 16.0f, 1, WHITE);
+    DrawTextEx(*font, "Level: ", layout->levelLabel, 16.0f, 1, WHITE);
+    DrawTextEx(*font, TextFormat("%d", contents.level), layout->levelValue, 16.0f, 1, WHITE);
+    DrawTextEx(*font, "High Score: ", layout->highScoreLabel, 16.0f, 1, WHITE);
+    DrawTextEx(*font, TextFormat("%d", contents.highScore), layout->highScoreValue, 16.0f, 1, WHITE);
+    DrawTextEx(*font, "Lives: ", layout->livesLabel, 16.0f, 1, WHITE);
+    EndBlendMode();
+
+    // Lives on the right, collected fruits on the left, from the premultiplied atlas
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    draw_hud_icons(pacman.sprite, SPRITE_LIFE_ICON, layout->livesIconsX, layout->iconsY, contents.lives);
+    draw_hud_icons(fruit.sprite, SPRITE_FRUIT, layout->fruitIconsX, layout->iconsY, contents.fruits);
+    EndBlendMode();
+    EndTextureMode();
+
+    hudLayerContents = contents;
+    hudLayerLayout = *layout;
+}
+
+// Unloads the HUD layer.
+void UnloadHudLayer(void) {
+    if (hudLayer.id != 0) {
+        UnloadRenderTexture(hudLayer);
+        hudLayer = (RenderTexture2D){ 0 };
+    }
+}
+
+// Blits the HUD layer, whose colours are premultiplied.
+void DrawHudLayer(void) {
+    if (hudLayer.id == 0) {
+        return;
+    }
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(hudLayer.texture,
+                   (Rectangle){ 0, 0, (float)hudLayer.texture.width, -(float)hudLayer.texture.height },
+                   (Vector2){ 0, 0 }, WHITE);
+    EndBlendMode();
+}
+
+// Rendering Functions
+// ----------------------------------------------------------------------------------------
+// Pushes the power pellets of a board drawn without the pellet layer. Each board has its own
+// blink phase, so these blink on the CPU rather than through the one palette time.
+static void render_power_pellets(int offsetX, int offsetY) {
+    bool powerPelletVisible = (blinkTimer < 0.5f); // Visible for first 0.5 seconds
+    if (!powerPelletVisible) {
+        return;
+    }
+    for (int y = 0; y < MAZE_HEIGHT; y++) {
+        uint32_t row = maze.powerPellets[y];
+        for (int x = 0; row != 0; x++, row >>= 1) {
+            if (row & 1u) {
+                int posX = offsetX + x * TILE_SIZE;
+                int posY = offsetY + y * TILE_SIZE;
+                PushCircleCommand((Vector2){ posX + TILE_SIZE / 2, posY + TILE_SIZE / 2 }, 5, ORANGE); // Larger power pellets
+            }
+        }
+    }
+}
+
+// Renders the maze, including walls, pellets, power pellets, ghost gate, and active fruit.
+// The wall layer must be current (see RefreshMazeTextures). Like the other render functions it only
+// reads game state; animations are advanced by update_animations().
+void render_maze(int offsetX, int offsetY) {
+    // First pass: The pellet layer, whose power pellets blink with the palette time
+    PushPaletteTimeCommand(blinkTimer);
+    int pellets = count_maze_pellets();
+    PushMazeCommand(RENDER_CMD_MAZE_PELLETS, offsetX, offsetY, mazeVersion, pellets);
+
+    // Second pass: The prebuilt walls
+    PushMazeCommand(RENDER_CMD_MAZE_WALLS, offsetX, offsetY, mazeVersion, pellets);
+
+    // Render fruit if active
+    render_fruit(offsetX, offsetY);
 }
 
 // Renders Pac-Man with mouth animation based on direction.
 void render_pacman(int offsetX, int offsetY) {
-    // Mouth animation
-    static float animTimer = 0.0f;
-    static int currentFrame = 0;
-    animTimer += GetFrameTime();
-    if (animTimer >= 0.1f) {
-        currentFrame = (currentFrame + 1) % 3;      // 3 frames: closed, half-open, fully open
-        animTimer = 0.0f;
-    } 
-
-    // Define source rectangle
-    Rectangle sourceRec = { currentFrame * 18.0f, 0.0f, 16.0f, 16.0f};
+    // Pre-rotated mouth frame for the current facing
+    Rectangle sourceRec = SPRITE_PACMAN[pacman.direction][pacman.currentFrame];
 
     // Define destination rectangle
     float scaleFactor = (float)TILE_SIZE / 16.0f; // Scale 16x16 sprite to 20x20
@@ -235,23 +412,14 @@ void render_pacman(int offsetX, int offsetY) {
         scaledHeight
     };
 
-    float rotation = 0.0f;
-    switch (pacman.direction) {
-        case DIR_RIGHT: rotation = 0.0f; break;
-        case DIR_LEFT: rotation = 180.0f; break;
-        case DIR_UP: rotation = 270.0f; break;
-        case DIR_DOWN: rotation = 90.0f; break;
-        default: break;
-    }
-
     Vector2 origin = { scaledWidth / 2.0f, scaledHeight / 2.0f };
-    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, rotation, WHITE);
+    PushSpriteCommand(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
 }
 
 // Renders Pac-Man's death animation with shrinking effect.
 void render_pacman_death(int offsetX, int offsetY) {
-    // Define source rectangle for death animation starting at x=36.0f
-    Rectangle sourceRec = { (deathAnimFrame * 16.0f) + 36.0f, 0.0f, 16.0f, 16.0f};
+    // Source rectangle for the current death animation frame
+    Rectangle sourceRec = SPRITE_PACMAN_DEATH[deathAnimFrame];
 
     // Define destination rectangle with shrinking effect
     float scaleFactor = (float)TILE_SIZE / 16.0f * (deathAnimTimer / 2.0f);     // Shrinks over 2 seconds
@@ -266,30 +434,44 @@ void render_pacman_death(int offsetX, int offsetY) {
     };
 
     Vector2 origin = { scaledWidth / 2.0f, scaledHeight / 2.0f};
-    DrawTexturePro(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
+    PushSpriteCommand(pacman.sprite, sourceRec, destRec, origin, 0.0f, WHITE);
 }
 
-// Renders all ghosts based on their state (normal, frightened, returning) and direction.
-void render_ghosts(int offsetX, int offsetY) {
-    for (int i = 0; i < MAX_GHOSTS; i++) {
-        // Update animation timer for normal ghost animation
-        ghosts[i].animTimer += GetFrameTime();
-        if (ghosts[i].animTimer >= 0.2f) {      // Switch frames every 0.2 seconds
-            ghosts[i].currentFrame = (ghosts[i].currentFrame + 1) % 2;
-            ghosts[i].animTimer = 0.0f;
-        }
+// Picks a ghost's atlas frame: the score popup while it is being eaten, eyes while returning,
+// blue while frightened (the palette shader flashes it white, see get_ghost_tint), otherwise its
+// body for the current facing and animation frame.
+Rectangle get_ghost_frame(int index) {
+    const Ghost *ghost = &ghosts[index];
+
+    if (gameState == STATE_GHOST_EATEN && index == eatenGhostIndex) {
+        // Points based on eatenGhostCount (from ghost_ai.c: 200, 400, 800, 1600)
+        int scoreIndex = eatenGhostCount - 1;
+        if (scoreIndex < 0 || scoreIndex > 3) scoreIndex = 0;
+        return SPRITE_GHOST_SCORE[scoreIndex];
+    }
+    if (ghost->state == GHOST_RETURNING) {
+        return SPRITE_GHOST_EYES[ghost->direction][ghost->currentFrame];
+    }
+    if (ghost->state == GHOST_FRIGHTENED) {
+        return SPRITE_GHOST_FRIGHTENED[0];
+    }
+    return SPRITE_GHOST[index][ghost->direction][ghost->currentFrame];
+}
 
-        // Update frightened blink timer for ghost
-        if (ghosts[i].state == GHOST_FRIGHTENED) {
-            ghosts[i].frightenedBlinkTimer += GetFrameTime();
-            if (ghosts[i].frightenedBlinkTimer >= 0.4f) { // Reset every 0.4 seconds (0.2s per texture)
-                ghosts[i].frightenedBlinkTimer = 0.0f;
-            }
-        }
+// Picks the tint for a ghost's frame: frightened ghosts carry their remaining time to the palette
+// shader, which flashes them white (0.2s each) during the last 2 seconds.
+Color get_ghost_tint(int index) {
+    const Ghost *ghost = &ghosts[index];
 
-        // Determine if we should use the white frightened sprite
-        bool useWhiteFrightenedSprite = (ghosts[i].frightenedBlinkTimer < 0.2f); // Use white sprite for first 0.2 seconds
+    if (ghost->state == GHOST_FRIGHTENED && !(gameState == STATE_GHOST_EATEN && index == eatenGhostIndex)) {
+        return GetSpritePaletteTint(SPRITE_PALETTE_FRIGHTENED, ghost->stateTimer);
+    }
+    return WHITE;
+}
 
+// Renders all ghosts based on their state (normal, frightened, returning) and direction.
+void render_ghosts(int offsetX, int offsetY) {
+    for (int i = 0; i < MAX_GHOSTS; i++) {
         // Adjust scale to fit within maze tiles (TILE_SIZE = 20)
         float ghostScaleFactor = (float)TILE_SIZE / 16.0f; // Scale 16x16 sprite to 20x20
         float scaledWidth = 16.0f * ghostScaleFactor;
@@ -305,73 +487,16 @@ void render_ghosts(int offsetX, int offsetY) {
 
         Vector2 origin = { scaledWidth / 2.0f, scaledHeight / 2.0f };
 
-        // If in STATE_GHOST_EATEN and this is the eaten ghost, show the score sprite
+        // Texture for the ghost's state; the score popup comes straight from the sheet
+        Texture2D texture = ghosts[i].normalSprite[ghosts[i].currentFrame];
         if (gameState == STATE_GHOST_EATEN && i == eatenGhostIndex) {
-            // Calculate points based on eatenGhostCount (from ghost_ai.c: 200, 400, 800, 1600)
-            int points = 200 * (1 << (eatenGhostCount - 1));
-            Rectangle scoreSourceRec;
-
-            // Map points to sprite coordinates
-            switch (points) {
-                case 200:  scoreSourceRec = (Rectangle){ 4.0f, 128.0f, 16.0f, 16.0f }; break;
-                case 400:  scoreSourceRec = (Rectangle){ 20.0f, 128.0f, 16.0f, 16.0f }; break;
-                case 800:  scoreSourceRec = (Rectangle){ 36.0f, 128.0f, 16.0f, 16.0f }; break;
-                case 1600: scoreSourceRec = (Rectangle){ 52.0f, 128.0f, 16.0f, 16.0f }; break;
-                default:   scoreSourceRec = (Rectangle){ 4.0f, 128.0f, 16.0f, 16.0f }; break;
-            }
-
-            DrawTexturePro(spriteSheet, scoreSourceRec, destRec, origin, 0.0f, WHITE);
-            continue; // Skip rendering the ghost itself while showing the score
-        }
-        
-        // Define source rectangle based on ghost's type and state
-        Rectangle sourceRec;
-        Texture2D texture;
-        
-        if (ghosts[i].state == GHOST_RETURNING) {
-            float xOffset;
-            switch (ghosts[i].direction) {
-                case DIR_RIGHT: xOffset = 132.0f + ghosts[i].currentFrame * 16.0f; break;       
-                case DIR_LEFT: xOffset = 148.0f + ghosts[i].currentFrame * 16.0f; break; 
-                case DIR_UP: xOffset = 164.0f + ghosts[i].currentFrame * 16.0f; break;  
-                case DIR_DOWN: xOffset = 180.0f + ghosts[i].currentFrame * 16.0f; break;
-                default: xOffset = 132.0f + ghosts[i].currentFrame * 16.0f; break;  
-            }
-            sourceRec = (Rectangle){ xOffset, 80.0f, 16.0f, 16.0f };
+            texture = spriteSheet;
+        } else if (ghosts[i].state == GHOST_RETURNING) {
             texture = ghosts[i].eyeballSprite;
         } else if (ghosts[i].state == GHOST_FRIGHTENED) {
-            // Default to blue frightened sprite
-            float xOffset = 132.0f; // Blue frightened sprite
-            // Blinking effect when frightened timer is low (last 2 seconds)
-            if (ghosts[i].stateTimer <= 2.0f) {
-                xOffset = useWhiteFrightenedSprite ? 164.0f : 132.0f; // Switch between white and blue
-            }
-            sourceRec = (Rectangle){ xOffset, 64.0f, 16.0f, 16.0f };
             texture = ghosts[i].frightenedSprite;
-        } else {
-            // Normal sprite based on ghost type (Blinky, Pinky, Inky, Clyde)
-            float xOffset;
-            float yOffset;
-            switch (i) {
-                case 0: yOffset = 64.0f; break;  // Blinky (red)
-                case 1: yOffset = 80.0f; break;  // Pinky (pink)
-                case 2: yOffset = 96.0f; break;  // Inky (cyan)
-                case 3: yOffset = 112.0f; break; // Clyde (orange)
-                default: yOffset = 64.0f; break;
-            }
-
-            // Select xOffset based on direction and animation frame
-            switch (ghosts[i].direction) {
-                case DIR_RIGHT: xOffset = 4.0f + ghosts[i].currentFrame * 16.0f; break;       
-                case DIR_LEFT: xOffset = 36.0f + ghosts[i].currentFrame * 16.0f; break; 
-                case DIR_UP: xOffset = 68.0f + ghosts[i].currentFrame * 16.0f; break;  
-                case DIR_DOWN: xOffset = 100.0f + ghosts[i].currentFrame * 16.0f; break;
-                default: xOffset = 4.0f + ghosts[i].currentFrame * 16.0f; break;              
-            }
-            sourceRec = (Rectangle){ xOffset, yOffset, 16.0f, 16.0f };
-            texture = ghosts[i].normalSprite[ghosts[i].currentFrame];
         }
-        DrawTexturePro(texture, sourceRec, destRec, origin, 0.0f, WHITE);
+        PushSpriteCommand(texture, get_ghost_frame(i), destRec, origin, 0.0f, get_ghost_tint(i));
     }
 }
 
@@ -382,7 +507,7 @@ void render_fruit(int offsetX, int offsetY) {
         float scaleFactor = (float)TILE_SIZE / 16.0f;
         float scaledWidth = 16.0f * scaleFactor;
         float scaledHeight = 16.0f * scaleFactor;
-        Rectangle sourceRec = { 35.0f, 48.0f, 16.0f, 16.0f };
+        Rectangle sourceRec = SPRITE_FRUIT;
 
         float tileCenterX = fruit.gridX * TILE_SIZE + offsetX + (TILE_SIZE / 2.0f);
         float tileCenterY = fruit.gridY * TILE_SIZE + offsetY + (TILE_SIZE / 2.0f);
@@ -395,6 +520,175 @@ void render_fruit(int offsetX, int offsetY) {
             scaledHeight
         };
         Vector2 origin = { 0.0f, 0.0f }; // Origin at top-left for precise positioning
-        DrawTexturePro(fruit.sprite, sourceRec, destRec, origin, 0.0f, WHITE); 
+        PushSpriteCommand(fruit.sprite, sourceRec, destRec, origin, 0.0f, WHITE); 
     }  
-}
\ No newline at end of file
+}
+
+// Renders the HUD as one command; the labels and icons themselves are in the HUD layer.
+void render_hud(const GameplayLayout *layout) {
+    PushHudCommand(layout->livesIconsX, layout->fruitIconsX, layout->iconsY, pacman.lives, totalFruitsCollected, pacman.score);
+}
+
+// Lays out the maze centered on the screen, with the HUD text above it and the icons below.
+GameplayLayout compute_gameplay_layout(int screenWidth, int screenHeight) {
+    GameplayLayout layout;
+    layout.screenWidth = screenWidth;
+    layout.screenHeight = screenHeight;
+    layout.mazeWidth = MAZE_WIDTH * TILE_SIZE;                      // 560px
+    layout.mazeHeight = MAZE_HEIGHT * TILE_SIZE;                    // 620px
+    layout.mazeOffsetX = (screenWidth - layout.mazeWidth) / 2;      // 360px at 1280 (180px on each side)
+    layout.mazeOffsetY = (screenHeight - layout.mazeHeight) / 2;    // 50px at 720 (top and bottom)
+
+    // HUD icon rows: lives on the right, collected fruits on the left
+    layout.livesIconsX = layout.mazeOffsetX + layout.mazeWidth - 80;
+    layout.fruitIconsX = layout.mazeOffsetX + 50;
+    layout.iconsY = screenHeight - 30;
+
+    // Score on the left, high score in the middle, level on the right, lives label by the icons
+    float right = layout.mazeOffsetX + layout.mazeWidth;
+    layout.scoreLabel = (Vector2){ layout.mazeOffsetX + 10, 10 };
+    layout.scoreValue = (Vector2){ layout.mazeOffsetX + 30, 25 };
+    layout.levelLabel = (Vector2){ right - 100, 10 };
+    layout.levelValue = (Vector2){ right - 70, 25 };
+    layout.highScoreLabel = (Vector2){ screenWidth / 2 - 70, 10 };
+    layout.highScoreValue = (Vector2){ screenWidth / 2 - 50, 25 };
+    layout.livesLabel = (Vector2){ right - 170, screenHeight - 40 };
+    layout.readyText = (Vector2){ screenWidth / 2 - 35, layout.mazeOffsetY + (14 * TILE_SIZE + 3) };
+    return layout;
+}
+
+// Renders the maze and everything moving in it, plus the HUD.
+void render_gameplay(const GameplayLayout *layout) {
+    int offsetX = layout->mazeOffsetX;
+    int offsetY = layout->mazeOffsetY;
+
+    render_maze(offsetX, offsetY);
+    if (gameState == STATE_DEATH_ANIM) {
+        render_pacman_death(offsetX, offsetY);
+    } else {
+        render_pacman(offsetX, offsetY);
+        render_ghosts(offsetX, offsetY);
+    }
+
+    render_hud(layout);
+}
+
+// Renders one of several games shown at once (mosaic.c). The pellet layer only holds the pellets of
+// the game it was built for, so pellets and the gate are pushed straight from the bitboards as rects.
+void render_board(int offsetX, int offsetY) {
+    for (int y = 0; y < MAZE_HEIGHT; y++) {
+        uint32_t row = maze.pellets[y] | maze.gates[y];
+        for (int x = 0; row != 0; x++, row >>= 1) {
+            if (!(row & 1u)) continue;
+            int posX = offsetX + x * TILE_SIZE;
+            int posY = offsetY + y * TILE_SIZE;
+            if (maze.gates[y] & (1u << x)) {
+                PushRectCommand((Rectangle){ posX, posY + TILE_SIZE / 2 - 2, TILE_SIZE, 4 }, WHITE);
+            } else {
+                PushRectCommand((Rectangle){ posX + TILE_SIZE / 2 - 2, posY + TILE_SIZE / 2 - 2, 4, 4 }, YELLOW);
+            }
+        }
+    }
+    render_power_pellets(offsetX, offsetY);
+    render_fruit(offsetX, offsetY);
+
+    if (gameState == STATE_DEATH_ANIM) {
+        render_pacman_death(offsetX, offsetY);
+    } else {
+        render_pacman(offsetX, offsetY);
+        render_ghosts(offsetX, offsetY);
+    }
+}
+
+// Renders the AI overlay: heatmap, ghost targets, predicted paths and chosen directions, then the
+// mode timers. Shapes are pushed as one run of rects followed by one run of lines, so the whole
+// overlay lands in a single batch with no texture switches.
+void render_ai_overlay(const Font *font, int offsetX, int offsetY, HeatmapMode heatmap) {
+    static const Color ghostColors[MAX_GHOSTS] = { RED, PINK, SKYBLUE, ORANGE };
+    static const char *ghostNames[MAX_GHOSTS] = { "BLINKY", "PINKY", "INKY", "CLYDE" };
+    static const char *stateNames[] = { "NORMAL", "FRIGHT", "EATEN", "PENNED", "RETURN" };
+    static const char *directionNames[] = { "-", "UP", "DOWN", "LEFT", "RIGHT" };
+    static const int stepX[5] = { 0, 0, 0, -1, 1 };     // Indexed by Direction
+    static const int stepY[5] = { 0, -1, 1, 0, 0 };
+    const float half = TILE_SIZE / 2.0f;
+
+    // Heatmap, brightness on a square root scale so rarely visited tiles still show
+    if (heatmap != HEATMAP_NONE) {
+        int (*visits)[MAZE_WIDTH] = (heatmap == HEATMAP_GHOSTS) ? ghostTileVisits : pacmanTileVisits;
+        Color heatColor = (heatmap == HEATMAP_GHOSTS) ? RED : YELLOW;
+        int highest = 1;
+        for (int y = 0; y < MAZE_HEIGHT; y++) {
+            for (int x = 0; x < MAZE_WIDTH; x++) {
+                if (visits[y][x] > highest) highest = visits[y][x];
+            }
+        }
+        for (int y = 0; y < MAZE_HEIGHT; y++) {
+            for (int x = 0; x < MAZE_WIDTH; x++) {
+                if (visits[y][x] == 0) continue;
+                float heat = sqrtf((float)visits[y][x] / highest);
+                PushRectCommand((Rectangle){ offsetX + x * TILE_SIZE, offsetY + y * TILE_SIZE, TILE_SIZE, TILE_SIZE },
+                                Fade(heatColor, 0.1f + 0.5f * heat));
+            }
+        }
+    }
+
+    // Target tiles
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        const GhostDecision *decision = &ghostDecisions[i];
+        if (!decision->valid || decision->targetX < 0) continue;
+        PushRectCommand((Rectangle){ offsetX + decision->targetX * TILE_SIZE + 2, offsetY + decision->targetY * TILE_SIZE + 2,
+                                     TILE_SIZE - 4, TILE_SIZE - 4 }, Fade(ghostColors[i], 0.6f));
+    }
+
+    // Predicted paths from the decision tile, then the direction taken from where the ghost is now
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        const GhostDecision *decision = &ghostDecisions[i];
+        if (!decision->valid) continue;
+        int x = decision->fromX;
+        int y = decision->fromY;
+        for (int p = 0; p < decision->pathLength; p++) {
+            int nextX = decision->pathX[p];
+            int nextY = decision->pathY[p];
+            if (abs(nextX - x) <= 1) {      // No line across the maze through the tunnel
+                PushLineCommand((Vector2){ offsetX + x * TILE_SIZE + half, offsetY + y * TILE_SIZE + half },
+                                (Vector2){ offsetX + nextX * TILE_SIZE + half, offsetY + nextY * TILE_SIZE + half },
+                                2.0f, Fade(ghostColors[i], 0.8f));
+            }
+            x = nextX;
+            y = nextY;
+        }
+    }
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        Direction direction = ghosts[i].direction;
+        if (!ghostDecisions[i].valid || direction == DIR_NONE) continue;
+        Vector2 center = { offsetX + ghosts[i].x, offsetY + ghosts[i].y };
+        PushLineCommand(center, (Vector2){ center.x + stepX[direction] * TILE_SIZE, center.y + stepY[direction] * TILE_SIZE },
+                        3.0f, WHITE);
+    }
+
+    // Mode timers and decisions, left of the maze
+    if (font == NULL) {
+        return;
+    }
+    float textX = 10.0f;
+    float textY = offsetY;
+    PushTextCommand(font, TextFormat("%s %.1f/%.1fS PHASE %d", (ghostMode == MODE_CHASE) ? "CHASE" : "SCATTER",
+                                     modeTimer, ghostModeDuration, ghostModePhase + 1),
+                    (Vector2){ textX, textY }, 10.0f, 1, WHITE);
+    PushTextCommand(font, TextFormat("POWER %.1fS  HEATMAP %s", powerPelletTimer,
+                                     (heatmap == HEATMAP_GHOSTS) ? "GHOSTS" : (heatmap == HEATMAP_PACMAN) ? "PAC-MAN" : "OFF"),
+                    (Vector2){ textX, textY + 14 }, 10.0f, 1, WHITE);
+    for (int i = 0; i < MAX_GHOSTS; i++) {
+        const GhostDecision *decision = &ghostDecisions[i];
+        char target[16] = "-";
+        if (decision->valid && decision->targetX < 0) {
+            strcpy(target, "RANDOM");
+        } else if (decision->valid) {
+            snprintf(target, sizeof(target), "%d,%d", decision->targetX, decision->targetY);
+        }
+        PushTextCommand(font, TextFormat("%-6s %-6s %4.1fS %s %s", ghostNames[i], stateNames[ghosts[i].state],
+                                         ghosts[i].stateTimer, target, directionNames[ghosts[i].direction]),
+                        (Vector2){ textX, textY + 34 + i * 14 }, 10.0f, 1, ghostColors[i]);
+    }
+}
+
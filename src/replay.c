@@ -0,0 +1,178 @@
+#include "replay.h"
+#include <time.h>
+
+#define REPLAY_MAGIC "PMRP"
+#define REPLAY_VERSION 1
+
+// File layout: header, then tickCount ReplayTicks, then keyframeCount ReplayKeyframes
+typedef struct {
+    char magic[4];
+    int version;
+    int snapshotSize;       // sizeof(GameSnapshot) of the build that wrote the file
+    int tickCount;
+    int keyframeCount;
+} ReplayHeader;
+
+static Replay recording = { 0 };
+static int tickCapacity = 0;
+static int keyframeCapacity = 0;
+static bool recordingActive = false;
+static GameSnapshot lastTickEnd;        // State the previous tick left behind
+static bool hasLastTickEnd = false;
+static int ticksSinceKeyframe = 0;
+
+static void free_recording(void) {
+    unload_replay(&recording);
+    tickCapacity = 0;
+    keyframeCapacity = 0;
+    hasLastTickEnd = false;
+    ticksSinceKeyframe = 0;
+}
+
+// Recording
+// ----------------------------------------------------------------------------------------
+void start_replay_recording(void) {
+    free_recording();
+    recordingActive = true;
+}
+
+bool is_replay_recording(void) {
+    return recordingActive;
+}
+
+void record_replay_tick(float deltaTime, Direction direction) {
+    if (!recordingActive) {
+        return;
+    }
+
+    // Anything that changed the game since the last tick (fades, menus) cannot be replayed from
+    // input, so the state is stored as it is now
+    GameSnapshot now;
+    capture_game_snapshot(&now);
+    if (!hasLastTickEnd || ticksSinceKeyframe >= REPLAY_KEYFRAME_INTERVAL ||
+        memcmp(&now, &lastTickEnd, sizeof(now)) != 0) {
+        if (recording.keyframeCount == keyframeCapacity) {
+            keyframeCapacity = keyframeCapacity ? keyframeCapacity * 2 : 16;
+            recording.keyframes = MemRealloc(recording.keyframes, keyframeCapacity * sizeof(ReplayKeyframe));
+        }
+        recording.keyframes[recording.keyframeCount ++] = (ReplayKeyframe){ recording.tickCount, now };
+        ticksSinceKeyframe = 0;
+    }
+
+    if (recording.tickCount == tickCapacity) {
+        tickCapacity = tickCapacity ? tickCapacity * 2 : 4096;
+        recording.ticks = MemRealloc(recording.ticks, tickCapacity * sizeof(ReplayTick));
+    }
+    recording.ticks[recording.tickCount ++] = (ReplayTick){ deltaTime, direction };
+    ticksSinceKeyframe ++;
+}
+
+void finish_replay_tick(void) {
+    if (!recordingActive) {
+        return;
+    }
+    capture_game_snapshot(&lastTickEnd);
+    hasLastTickEnd = true;
+}
+
+bool stop_replay_recording(const char *directory) {
+    if (!recordingActive) {
+        return false;
+    }
+    recordingActive = false;
+    if (recording.tickCount == 0) {
+        free_recording();
+        return false;
+    }
+
+    if (!DirectoryExists(directory)) {
+        MakeDirectory(directory);
+    }
+    char stamp[32];
+    time_t now = time(NULL);
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", localtime(&now));
+    const char *fileName = TextFormat("%s/replay_%s.rpl", directory, stamp);
+
+    FILE *file = fopen(fileName, "wb");
+    bool ok = file != NULL;
+    if (ok) {
+        ReplayHeader header = { { REPLAY_MAGIC[0], REPLAY_MAGIC[1], REPLAY_MAGIC[2], REPLAY_MAGIC[3] },
+                                REPLAY_VERSION, (int)sizeof(GameSnapshot), recording.tickCount, recording.keyframeCount };
+        ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(recording.ticks, sizeof(ReplayTick), recording.tickCount, file) == (size_t)recording.tickCount &&
+             fwrite(recording.keyframes, sizeof(ReplayKeyframe), recording.keyframeCount, file) == (size_t)recording.keyframeCount;
+        ok = (fclose(file) == 0) && ok;
+    }
+    printf(ok ? "Replay saved to %s (%d ticks)\n" : "Failed to save replay %s (%d ticks)\n", fileName, recording.tickCount);
+
+    free_recording();
+    return ok;
+}
+
+// Playback
+// ----------------------------------------------------------------------------------------
+bool load_replay(const char *fileName, Replay *replay) {
+    *replay = (Replay){ 0 };
+
+    FILE *file = fopen(fileName, "rb");
+    if (!file) {
+        return false;
+    }
+
+    ReplayHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+              memcmp(header.magic, REPLAY_MAGIC, 4) == 0 && header.version == REPLAY_VERSION &&
+              header.snapshotSize == (int)sizeof(GameSnapshot) &&
+              header.tickCount > 0 && header.keyframeCount > 0;
+    if (ok) {
+        replay->ticks = MemAlloc(header.tickCount * sizeof(ReplayTick));
+        replay->keyframes = MemAlloc(header.keyframeCount * sizeof(ReplayKeyframe));
+        replay->tickCount = header.tickCount;
+        replay->keyframeCount = header.keyframeCount;
+        ok = fread(replay->ticks, sizeof(ReplayTick), header.tickCount, file) == (size_t)header.tickCount &&
+             fread(replay->keyframes, sizeof(ReplayKeyframe), header.keyframeCount, file) == (size_t)header.keyframeCount &&
+             replay->keyframes[0].tick == 0;
+    }
+    fclose(file);
+
+    if (!ok) {
+        unload_replay(replay);
+    }
+    return ok;
+}
+
+void unload_replay(Replay *replay) {
+    MemFree(replay->ticks);
+    MemFree(replay->keyframes);
+    *replay = (Replay){ 0 };
+}
+
+int find_replay_keyframe(const Replay *replay, int tick) {
+    int low = 0;
+    int high = replay->keyframeCount - 1;
+    int found = -1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (replay->keyframes[mid].tick <= tick) {
+            found = mid;
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return found;
+}
+
+void play_replay_tick(const Replay *replay, int tick) {
+    int keyframe = find_replay_keyframe(replay, tick);
+    if (keyframe >= 0 && replay->keyframes[keyframe].tick == tick) {
+        restore_game_snapshot(&replay->keyframes[keyframe].state);
+    }
+
+    const ReplayTick *input = &replay->ticks[tick];
+    simDeltaTime = input->deltaTime;
+    if (gameState == STATE_PLAYING && input->direction != DIR_NONE) {
+        pacman.nextDirection = input->direction;
+    }
+    step_gameplay();    // Whatever the windowed game did after a fade was recorded as a keyframe
+}
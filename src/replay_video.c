@@ -0,0 +1,340 @@
+#include "replay_video.h"
+#include "replay.h"
+#include "render_commands.h"
+#include "rendering.h"
+#include "soft_render.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#define popen _popen
+#define pclose _pclose
+#else
+#include <unistd.h>
+#endif
+
+#define Y4M_FRAME_SIZE (SCREEN_WIDTH * SCREEN_HEIGHT * 3 / 2)     // 4:2:0, one byte per sample
+
+typedef struct {
+    const char *replayFile;
+    const char *format;
+    const char *out;
+    int jobs;
+    int segmentFirst;       // Set (with segmentLast) when this process renders one segment for a parent
+    int segmentLast;
+} VideoOptions;
+
+static Replay replay = { 0 };
+static double *tickEndTimes = NULL;     // Recorded time at the end of each tick, in seconds
+static unsigned char yuvFrame[Y4M_FRAME_SIZE];
+
+static int cpu_count(void) {
+#if defined(_WIN32)
+    const char *count = getenv("NUMBER_OF_PROCESSORS");
+    return (count && atoi(count) > 0) ? atoi(count) : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#endif
+}
+
+static bool parse_options(int argc, char *argv[], VideoOptions *options) {
+    *options = (VideoOptions){ NULL, "y4m", NULL, cpu_count(), -1, -1 };
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--render-replay") == 0 && hasValue) {
+            options->replayFile = argv[++i];
+        } else if (strcmp(arg, "--format") == 0 && hasValue) {
+            options->format = argv[++i];
+        } else if (strcmp(arg, "--out") == 0 && hasValue) {
+            options->out = argv[++i];
+        } else if (strcmp(arg, "--jobs") == 0 && hasValue) {
+            options->jobs = atoi(argv[++i]);
+        } else if (strcmp(arg, "--segment") == 0 && i + 2 < argc) {
+            options->segmentFirst = atoi(argv[++i]);
+            options->segmentLast = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "replay: unknown or incomplete option %s\n", arg);
+            return false;
+        }
+    }
+
+    bool y4m = strcmp(options->format, "y4m") == 0;
+    if (!y4m && strcmp(options->format, "png") != 0 && strcmp(options->format, "ppm") != 0) {
+        fprintf(stderr, "replay: --format must be y4m, png or ppm\n");
+        return false;
+    }
+    if (options->jobs <= 0) {
+        fprintf(stderr, "replay: --jobs must be positive\n");
+        return false;
+    }
+    if (options->out == NULL) {
+        options->out = y4m ? "-" : "frames";
+    }
+    return true;
+}
+
+// Frames shown before a tick runs: frame f is taken after the first tick that ends at or past f / FPS
+static int frames_before_tick(int tick) {
+    if (tick == 0) {
+        return 0;
+    }
+    return (int)floor(tickEndTimes[tick - 1] * REPLAY_VIDEO_FPS + 1e-6) + 1;
+}
+
+// Y4M Output
+// ----------------------------------------------------------------------------------------
+static void write_y4m_header(FILE *file) {
+    fprintf(file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", SCREEN_WIDTH, SCREEN_HEIGHT, REPLAY_VIDEO_FPS);
+}
+
+// BT.601 studio range; chroma from the average of each 2x2 block
+static void convert_frame_to_yuv(Image frame) {
+    const Color *pixels = (const Color *)frame.data;
+    unsigned char *planeY = yuvFrame;
+    unsigned char *planeU = yuvFrame + SCREEN_WIDTH * SCREEN_HEIGHT;
+    unsigned char *planeV = planeU + (SCREEN_WIDTH / 2) * (SCREEN_HEIGHT / 2);
+
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        Color c = pixels[i];
+        planeY[i] = (unsigned char)(((66 * c.r + 129 * c.g + 25 * c.b + 128) >> 8) + 16);
+    }
+
+    for (int y = 0; y < SCREEN_HEIGHT / 2; y++) {
+        for (int x = 0; x < SCREEN_WIDTH / 2; x++) {
+            const Color *top = &pixels[(y * 2) * SCREEN_WIDTH + x * 2];
+            const Color *bottom = top + SCREEN_WIDTH;
+            int r = (top[0].r + top[1].r + bottom[0].r + bottom[1].r + 2) / 4;
+            int g = (top[0].g + top[1].g + bottom[0].g + bottom[1].g + 2) / 4;
+            int b = (top[0].b + top[1].b + bottom[0].b + bottom[1].b + 2) / 4;
+            int index = y * (SCREEN_WIDTH / 2) + x;
+            planeU[index] = (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            planeV[index] = (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+}
+
+// Hands the real stdout over for video and points stdout at stderr, so the game's log lines
+// cannot end up inside the stream
+static FILE *take_stdout(void) {
+    fflush(stdout);
+#if defined(_WIN32)
+    int videoFd = _dup(_fileno(stdout));
+    _dup2(_fileno(stderr), _fileno(stdout));
+    _setmode(videoFd, _O_BINARY);
+    return _fdopen(videoFd, "wb");
+#else
+    int videoFd = dup(STDOUT_FILENO);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+    return fdopen(videoFd, "wb");
+#endif
+}
+
+// Appends a finished part to the video and deletes it
+static bool append_part(FILE *video, const char *partName) {
+    FILE *part = fopen(partName, "rb");
+    if (!part) {
+        return false;
+    }
+    static unsigned char buffer[1 << 16];
+    size_t count;
+    bool ok = true;
+    while ((count = fread(buffer, 1, sizeof(buffer), part)) > 0) {
+        ok = ok && fwrite(buffer, 1, count, video) == count;
+    }
+    fclose(part);
+    remove(partName);
+    return ok;
+}
+
+// Segments
+// ----------------------------------------------------------------------------------------
+// Plays ticks [first, last) and writes the frames they cover. first must be a keyframe tick.
+// Y4M frames go to video without a header; images are numbered across the whole replay.
+static bool render_segment(const VideoOptions *options, int first, int last, FILE *video) {
+    const GameplayLayout layout = compute_gameplay_layout(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    int frameIndex = frames_before_tick(first);
+    for (int tick = first; tick < last; tick++) {
+        play_replay_tick(&replay, tick);
+        clear_tile_journal();
+
+        int frameCount = frames_before_tick(tick + 1) - frameIndex;
+        if (frameCount <= 0) {
+            continue;
+        }
+
+        BeginRenderCommands();
+        PushClearCommand(BLACK);
+        render_gameplay(&layout);
+        SubmitRenderCommands(RENDER_BACKEND_SOFTWARE);
+
+        // A tick longer than a video frame (a slow frame in the original session) repeats its image
+        if (video != NULL) {
+            convert_frame_to_yuv(GetSoftFrame());
+            for (int i = 0; i < frameCount; i++) {
+                if (fputs("FRAME\n", video) == EOF || fwrite(yuvFrame, 1, Y4M_FRAME_SIZE, video) != Y4M_FRAME_SIZE) {
+                    fprintf(stderr, "replay: cannot write video\n");
+                    return false;
+                }
+            }
+        } else {
+            for (int i = 0; i < frameCount; i++) {
+                const char *fileName = TextFormat("%s/frame_%06d.%s", options->out, frameIndex + i, options->format);
+                if (!ExportSoftFrame(fileName)) {
+                    fprintf(stderr, "replay: cannot write %s\n", fileName);
+                    return false;
+                }
+            }
+        }
+        frameIndex += frameCount;
+    }
+    return true;
+}
+
+// Renders one segment in this process, for a parent that split the replay (--segment)
+static int run_segment(const VideoOptions *options) {
+    if (options->segmentFirst < 0 || options->segmentLast > replay.tickCount || options->segmentFirst >= options->segmentLast ||
+        replay.keyframes[find_replay_keyframe(&replay, options->segmentFirst)].tick != options->segmentFirst) {
+        fprintf(stderr, "replay: --segment must start on a keyframe and lie within the replay\n");
+        return EXIT_FAILURE;
+    }
+
+    bool y4m = strcmp(options->format, "y4m") == 0;
+    FILE *video = y4m ? fopen(options->out, "wb") : NULL;
+    if (y4m && !video) {
+        fprintf(stderr, "replay: cannot write %s\n", options->out);
+        return EXIT_FAILURE;
+    }
+    bool ok = render_segment(options, options->segmentFirst, options->segmentLast, video);
+    if (video) {
+        ok = (fclose(video) == 0) && ok;
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Starts a copy of this executable on one segment; its own output goes to our stderr
+static FILE *spawn_segment(const char *executable, const VideoOptions *options, int first, int last, const char *out) {
+    char command[4096];
+    snprintf(command, sizeof(command),
+#if defined(_WIN32)
+             "\"\"%s\" --render-replay \"%s\" --segment %d %d --format %s --out \"%s\" 1>&2\"",     // cmd strips the outer quotes
+#else
+             "\"%s\" --render-replay \"%s\" --segment %d %d --format %s --out \"%s\" 1>&2",
+#endif
+             executable, options->replayFile, first, last, options->format, out);
+    return popen(command, "r");
+}
+
+// Replay Video
+// ----------------------------------------------------------------------------------------
+bool is_replay_video_run(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--render-replay") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int run_replay_video(int argc, char *argv[]) {
+    VideoOptions options;
+    if (!parse_options(argc, argv, &options)) {
+        return EXIT_FAILURE;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    if (!load_replay(options.replayFile, &replay)) {
+        fprintf(stderr, "replay: cannot load %s (missing, damaged, or recorded by another build)\n", options.replayFile);
+        return EXIT_FAILURE;
+    }
+    tickEndTimes = MemAlloc(replay.tickCount * sizeof(double));
+    double time = 0.0;
+    for (int i = 0; i < replay.tickCount; i++) {
+        time += replay.ticks[i].deltaTime;
+        tickEndTimes[i] = time;
+    }
+
+    bool y4m = strcmp(options.format, "y4m") == 0;
+    bool segmentRun = options.segmentLast >= 0;
+    bool ok = true;
+    int exitCode = EXIT_SUCCESS;
+    if (!InitSoftRenderer()) {
+        exitCode = EXIT_FAILURE;
+    } else if (segmentRun) {
+        exitCode = run_segment(&options);
+    } else {
+        struct timespec start, end;
+        timespec_get(&start, TIME_UTC);
+
+        if (!y4m && !DirectoryExists(options.out) && MakeDirectory(options.out) != 0) {
+            fprintf(stderr, "replay: cannot create %s\n", options.out);
+            ok = false;
+        }
+
+        // Segment boundaries at the keyframes nearest to equal shares of the ticks
+        int jobs = (options.jobs < replay.keyframeCount) ? options.jobs : replay.keyframeCount;
+        int *bounds = MemAlloc((jobs + 1) * sizeof(int));
+        bounds[jobs] = replay.tickCount;
+        for (int j = 1; j < jobs; j++) {
+            int keyframe = find_replay_keyframe(&replay, (int)((long long)replay.tickCount * j / jobs));
+            bounds[j] = replay.keyframes[keyframe].tick;
+        }
+
+        FILE *video = NULL;
+        if (ok && y4m) {
+            video = (strcmp(options.out, "-") == 0) ? take_stdout() : fopen(options.out, "wb");
+            if (!video) {
+                fprintf(stderr, "replay: cannot write %s\n", options.out);
+                ok = false;
+            } else {
+                write_y4m_header(video);
+            }
+        }
+
+        if (ok && jobs == 1) {
+            ok = render_segment(&options, 0, replay.tickCount, video);
+        } else if (ok) {
+            FILE **children = MemAlloc(jobs * sizeof(FILE *));
+            char (*partNames)[512] = MemAlloc(jobs * sizeof(*partNames));
+            for (int j = 0; j < jobs; j++) {
+                if (bounds[j] == bounds[j + 1]) continue;     // Two shares fell on the same keyframe
+                snprintf(partNames[j], sizeof(partNames[j]), "%s.part%d", options.replayFile, j);
+                children[j] = spawn_segment(argv[0], &options, bounds[j], bounds[j + 1], y4m ? partNames[j] : options.out);
+                ok = ok && children[j] != NULL;
+            }
+            for (int j = 0; j < jobs; j++) {
+                if (children[j] == NULL) continue;
+                ok = (pclose(children[j]) == 0) && ok;
+            }
+            for (int j = 0; j < jobs && y4m; j++) {
+                if (children[j] == NULL) continue;
+                ok = append_part(video, partNames[j]) && ok;
+            }
+            MemFree(partNames);
+            MemFree(children);
+        }
+        if (video) {
+            ok = (fclose(video) == 0) && ok;
+        }
+
+        timespec_get(&end, TIME_UTC);
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        fprintf(stderr, "replay: %d ticks (%.1f s of play), %d frames in %.2f s with %d jobs%s\n",
+                replay.tickCount, time, frames_before_tick(replay.tickCount), seconds, jobs, ok ? "" : ", FAILED");
+        MemFree(bounds);
+        exitCode = ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    UnloadSoftRenderer();
+    MemFree(tickEndTimes);
+    unload_replay(&replay);
+    return exitCode;
+}
@@ -0,0 +1,115 @@
+#include "screen_layout.h"
+#include "post_process.h"
+#include "text_cache.h"
+
+static ScreenLayout layout = { 0 };
+static int layoutWindowWidth = -1;      // Window size the layout was computed for (-1: not yet)
+static int layoutWindowHeight = -1;
+
+// Top-left corner that centers a fixed string on centerX
+static Vector2 centered(Font font, const char *text, float fontSize, float spacing, float centerX, float y) {
+    Vector2 size = MeasureTextCached(font, text, fontSize, spacing);
+    return (Vector2){ centerX - size.x / 2.0f, y };
+}
+
+// Main menu, high scores and about screens
+static void layout_menu_screens(Font font, float cx, float cy) {
+    layout.menu.spriteY = layout.canvasHeight / 4.0f - 16.0f;
+    layout.menu.spriteWrapX = layout.canvasWidth + 32.0f;
+    layout.menu.optionsY = cy - 40.0f;
+    layout.menu.title = centered(font, "Pac-Man", 20.0f, 1, cx, cy - 100.0f);
+    layout.menu.hint = centered(font, "Use UP/DOWN to select, ENTER to confirm", 10.0f, 1, cx, cy + 110.0f);
+
+    layout.highscores.title = centered(font, "High Scores", 20.0f, 1, cx, cy - 100.0f);
+    layout.highscores.rowsY = cy - 60.0f;
+    layout.highscores.hint = centered(font, "Press ENTER or ESC to return", 10.0f, 1, cx, cy + 100.0f);
+
+    layout.about[0] = centered(font, "About Pac-Man Remake", 20.0f, 1, cx, cy - 100.0f);
+    layout.about[1] = centered(font, "Developed by Kyle Gregory Ibo", 16.0f, 1, cx, cy - 40.0f);
+    layout.about[2] = centered(font, "Powered by Raylib", 16.0f, 1, cx, cy - 10.0f);
+    layout.about[3] = centered(font, "Version 1.0", 16.0f, 1, cx, cy + 20.0f);
+    layout.about[4] = centered(font, "Press ENTER or ESC to return", 10.0f, 1, cx, cy + 80.0f);
+}
+
+// Settings and pause pages: 16pt options 30px apart, centered as a block, title 60px above
+static void layout_menus_over_game(Font font, float cx, float cy) {
+    const char *settingsOptions[LAYOUT_SETTINGS_OPTIONS] = { "BG MUSIC VOLUME", "SFX VOLUME", "MUTE" };
+    const char *pauseOptions[LAYOUT_PAUSE_OPTIONS] = { "RESUME", "RESTART", "SETTINGS", "QUIT" };
+    const float fontSize = 16.0f;
+    const float spacing = 30.0f;
+
+    float startY = (int)cy - (int)(LAYOUT_SETTINGS_OPTIONS * spacing) / 2;
+    layout.settings.title = centered(font, "SETTINGS", fontSize * 1.25f, 2, cx, startY - 60.0f);
+    layout.settings.pauseTitle = centered(font, "PAUSE MENU - SETTINGS", fontSize * 1.25f, 2, cx, startY - 60.0f);
+    for (int i = 0; i < LAYOUT_SETTINGS_OPTIONS; i++) {
+        // Labels are right aligned against the sliders
+        Vector2 size = MeasureTextCached(font, settingsOptions[i], fontSize, 2);
+        layout.settings.labels[i] = (Vector2){ cx - size.x - 30.0f, startY + i * spacing };
+    }
+    layout.settings.sliderX = cx + 10.0f;
+    layout.settings.pauseHint = (Vector2){ cx - 120.0f, startY + LAYOUT_SETTINGS_OPTIONS * spacing + 20.0f };
+
+    startY = (int)cy - (int)(LAYOUT_PAUSE_OPTIONS * spacing) / 2;
+    layout.pause.title = centered(font, "PAUSED", fontSize * 1.25f, 2, cx, startY - 60.0f);
+    for (int i = 0; i < LAYOUT_PAUSE_OPTIONS; i++) {
+        layout.pause.options[i] = centered(font, pauseOptions[i], fontSize, 2, cx, startY + i * spacing);
+    }
+
+    layout.levelComplete.title = centered(font, "Level Complete!", 20.0f, 1, cx, cy - 80.0f);
+    layout.levelComplete.subtitleY = cy - 40.0f;
+    layout.levelComplete.panelY = cy - 10.0f;
+    layout.levelComplete.breakdownY = cy;
+    layout.levelComplete.barY = cy + 100.0f;
+}
+
+static void layout_game_over(Font font, float cx, float cy) {
+    GameOverLayout *gameOver = &layout.gameOver;
+    gameOver->title = centered(font, "Game Over", 24.0f, 1, cx, cy - 150.0f);
+    gameOver->finalScoreY = cy - 90.0f;
+    gameOver->messageY = cy - 60.0f;
+    gameOver->enterInitialsLabel = centered(font, "Enter Initials:", 16.0f, 1, cx, cy - 30.0f);
+    gameOver->initialsLabel = centered(font, "Initials:", 16.0f, 1, cx, cy - 30.0f);
+    gameOver->nameY = cy;
+    gameOver->confirmHint = centered(font, "Press ENTER to confirm", 10.0f, 1, cx, cy + 30.0f);
+    gameOver->inputScoreBox = (Rectangle){ cx - 90.0f, cy + 50.0f, 180.0f, 130.0f };
+    gameOver->scoreBox = (Rectangle){ cx - 80.0f, cy + 50.0f, 160.0f, 120.0f };
+    gameOver->highScoresLabel = centered(font, "High Scores:", 16.0f, 1, cx, cy + 60.0f);
+    gameOver->scoreRowsY = cy + 80.0f;
+    gameOver->returnHint = centered(font, "Press ENTER to Return to Menu", 10.0f, 1, cx, cy + 180.0f);
+    gameOver->saveError = centered(font, "Failed to save high score!", 12.0f, 1, cx, cy + 210.0f);
+}
+
+// Screen Layout
+// ----------------------------------------------------------------------------------------
+bool UpdateScreenLayout(Font font) {
+    int windowWidth = GetScreenWidth();
+    int windowHeight = GetScreenHeight();
+    if (windowWidth == layoutWindowWidth && windowHeight == layoutWindowHeight) {
+        return false;
+    }
+    layoutWindowWidth = windowWidth;
+    layoutWindowHeight = windowHeight;
+
+    Vector2 canvas = GetVirtualScreenSize();
+    layout.canvasWidth = (int)canvas.x;
+    layout.canvasHeight = (int)canvas.y;
+    layout.centerX = (float)(layout.canvasWidth / 2);
+    layout.centerY = (float)(layout.canvasHeight / 2);
+
+    layout.window = (Rectangle){ 0, 0, (float)windowWidth, (float)windowHeight };
+    layout.virtualScreen = GetVirtualScreenRect();
+
+    layout.gameplay = compute_gameplay_layout(layout.canvasWidth, layout.canvasHeight);
+    layout_menu_screens(font, layout.centerX, layout.centerY);
+    layout_menus_over_game(font, layout.centerX, layout.centerY);
+    layout_game_over(font, layout.centerX, layout.centerY);
+
+    layout.renderStatsLine = (Vector2){ 10, windowHeight - 20.0f };
+    layout.frameStatsLine = (Vector2){ 10, windowHeight - 36.0f };
+    layout.frameHistogram = (Rectangle){ 10, windowHeight - 110.0f, 256, 64 };
+    return true;
+}
+
+const ScreenLayout *GetScreenLayout(void) {
+    return &layout;
+}
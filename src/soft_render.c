@@ -0,0 +1,235 @@
+#include "soft_render.h"
+#include "rendering.h"
+#include "maze_mesh.h"
+#include "sprite_atlas.h"
+#include "sprite_frames.h"
+#include "sprite_palette.h"
+#include <math.h>
+#include <stdio.h>
+
+static Image frame = { 0 };         // R8G8B8A8, SCREEN_WIDTH x SCREEN_HEIGHT
+static Image atlas = { 0 };         // R8G8B8A8, premultiplied alpha
+static Mesh wallTriangles = { 0 };  // CPU-only wall outline
+static int wallTrianglesVersion = -1;
+
+static void free_wall_triangles(void) {
+    MemFree(wallTriangles.vertices);
+    MemFree(wallTriangles.texcoords);
+    MemFree(wallTriangles.indices);
+    wallTriangles = (Mesh){ 0 };
+}
+
+// Software Renderer
+// ----------------------------------------------------------------------------------------
+bool InitSoftRenderer(void) {
+    atlas = LoadImage(SPRITE_ATLAS_PATH);
+    if (atlas.data == NULL || atlas.width != SPRITE_ATLAS_WIDTH || atlas.height != SPRITE_ATLAS_HEIGHT) {
+        UnloadImage(atlas);
+        Image sheet = LoadImage(SPRITE_SHEET_PATH);
+        atlas = BakeSpriteAtlas(sheet);
+        UnloadImage(sheet);
+    }
+    if (atlas.data == NULL) {
+        printf("Software renderer: no sprite atlas\n");
+        return false;
+    }
+    ImageFormat(&atlas, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    frame = GenImageColor(SCREEN_WIDTH, SCREEN_HEIGHT, BLACK);
+    return true;
+}
+
+void UnloadSoftRenderer(void) {
+    UnloadImage(frame);
+    UnloadImage(atlas);
+    frame = (Image){ 0 };
+    atlas = (Image){ 0 };
+    free_wall_triangles();
+    wallTrianglesVersion = -1;
+}
+
+Image GetSoftFrame(void) {
+    return frame;
+}
+
+bool ExportSoftFrame(const char *fileName) {
+    if (!IsFileExtension(fileName, ".ppm")) {
+        return ExportImage(frame, fileName);
+    }
+
+    FILE *file = fopen(fileName, "wb");
+    if (!file) {
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", frame.width, frame.height);
+    const Color *pixels = (const Color *)frame.data;
+    for (int i = 0; i < frame.width * frame.height; i++) {
+        fputc(pixels[i].r, file);
+        fputc(pixels[i].g, file);
+        fputc(pixels[i].b, file);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+// Primitives
+// ----------------------------------------------------------------------------------------
+void SoftClear(Color color) {
+    ImageClearBackground(&frame, color);
+}
+
+void SoftDrawRectangle(int x, int y, int width, int height, Color color) {
+    ImageDrawRectangle(&frame, x, y, width, height, color);
+}
+
+void SoftDrawCircle(int centerX, int centerY, int radius, Color color) {
+    ImageDrawCircle(&frame, centerX, centerY, radius, color);
+}
+
+// Edge function: positive when p is to the left of a->b (counter-clockwise in screen space)
+static float edge(Vector2 a, Vector2 b, float px, float py) {
+    return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+}
+
+// Top-left rule: pixels exactly on a shared edge belong to only one of the two triangles
+static bool is_top_left(Vector2 a, Vector2 b) {
+    return (a.y == b.y && b.x < a.x) || b.y > a.y;
+}
+
+void SoftDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    if (edge(v1, v2, v3.x, v3.y) < 0.0f) {
+        Vector2 swap = v2; v2 = v3; v3 = swap;     // Wind counter-clockwise
+    }
+    float area = edge(v1, v2, v3.x, v3.y);
+    if (area == 0.0f) {
+        return;
+    }
+
+    int minX = (int)fmaxf(floorf(fminf(v1.x, fminf(v2.x, v3.x))), 0.0f);
+    int maxX = (int)fminf(ceilf(fmaxf(v1.x, fmaxf(v2.x, v3.x))), (float)frame.width - 1);
+    int minY = (int)fmaxf(floorf(fminf(v1.y, fminf(v2.y, v3.y))), 0.0f);
+    int maxY = (int)fminf(ceilf(fmaxf(v1.y, fmaxf(v2.y, v3.y))), (float)frame.height - 1);
+
+    bool topLeft12 = is_top_left(v1, v2);
+    bool topLeft23 = is_top_left(v2, v3);
+    bool topLeft31 = is_top_left(v3, v1);
+
+    Color *pixels = (Color *)frame.data;
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            float px = x + 0.5f;
+            float py = y + 0.5f;
+            float w1 = edge(v2, v3, px, py);
+            float w2 = edge(v3, v1, px, py);
+            float w3 = edge(v1, v2, px, py);
+            if ((w1 > 0.0f || (w1 == 0.0f && topLeft23)) &&
+                (w2 > 0.0f || (w2 == 0.0f && topLeft31)) &&
+                (w3 > 0.0f || (w3 == 0.0f && topLeft12))) {
+                pixels[y * frame.width + x] = color;
+            }
+        }
+    }
+}
+
+void SoftDrawSprite(Rectangle source, Rectangle dest, Vector2 origin, Color tint) {
+    int left = (int)floorf(dest.x - origin.x + 0.5f);
+    int top = (int)floorf(dest.y - origin.y + 0.5f);
+    int width = (int)(dest.width + 0.5f);
+    int height = (int)(dest.height + 0.5f);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    const Color *texels = (const Color *)atlas.data;
+    Color *pixels = (Color *)frame.data;
+    for (int y = 0; y < height; y++) {
+        int frameY = top + y;
+        if (frameY < 0 || frameY >= frame.height) continue;
+        int texelY = (int)(source.y + (y + 0.5f) * source.height / height);
+
+        for (int x = 0; x < width; x++) {
+            int frameX = left + x;
+            if (frameX < 0 || frameX >= frame.width) continue;
+            int texelX = (int)(source.x + (x + 0.5f) * source.width / width);
+            if (texelX < 0 || texelX >= atlas.width || texelY < 0 || texelY >= atlas.height) continue;
+
+            // Same as BLEND_ALPHA_PREMULTIPLY: src * tint + dst * (1 - srcAlpha), with the palette shader's colour swaps
+            Color src = ApplySpritePalette(texels[texelY * atlas.width + texelX], tint);
+            int r = src.r;
+            int g = src.g;
+            int b = src.b;
+            int a = src.a;
+            if (a == 0 && r == 0 && g == 0 && b == 0) continue;
+
+            Color *pixel = &pixels[frameY * frame.width + frameX];
+            pixel->r = (unsigned char)(r + pixel->r * (255 - a) / 255);
+            pixel->g = (unsigned char)(g + pixel->g * (255 - a) / 255);
+            pixel->b = (unsigned char)(b + pixel->b * (255 - a) / 255);
+            pixel->a = 255;
+        }
+    }
+}
+
+// Maze Layers
+// ----------------------------------------------------------------------------------------
+void SoftDrawMazePellets(int offsetX, int offsetY) {
+    // Blinks with the palette time, as the pellet layer does through the palette shader
+    Color powerPelletColor = ApplySpritePalette(POWER_PELLET_COLOR, GetSpritePaletteTint(SPRITE_PALETTE_POWER_PELLETS, 0.0f));
+
+    for (int y = 0; y < MAZE_HEIGHT; y++) {
+        for (int x = 0; x < MAZE_WIDTH; x++) {
+            int posX = offsetX + x * TILE_SIZE;
+            int posY = offsetY + y * TILE_SIZE;
+            switch (get_tile(x, y)) {
+                case PELLET:
+                    SoftDrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 2, YELLOW);
+                    break;
+                case POWER_PELLET:
+                    if (powerPelletColor.a > 0) {
+                        SoftDrawCircle(posX + TILE_SIZE / 2, posY + TILE_SIZE / 2, 5, powerPelletColor);
+                    }
+                    break;
+                case GHOST_GATE:
+                    SoftDrawRectangle(posX, posY + TILE_SIZE / 2 - 2, TILE_SIZE, 4, WHITE);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+// Fills the wall outline from the same triangles the wall mesh uses, rebuilt when a maze is loaded
+void SoftDrawMazeWalls(int offsetX, int offsetY) {
+    if (wallTrianglesVersion != mazeVersion) {
+        free_wall_triangles();
+        wallTriangles = GenMazeWallMesh();
+        wallTrianglesVersion = mazeVersion;
+    }
+
+    const float *v = wallTriangles.vertices;
+    for (int i = 0; i < wallTriangles.triangleCount; i++) {
+        Vector2 corners[3];
+        for (int k = 0; k < 3; k++) {
+            int index = wallTriangles.indices[i * 3 + k];
+            corners[k] = (Vector2){ v[index * 3 + 0] + offsetX, v[index * 3 + 1] + offsetY };
+        }
+        SoftDrawTriangle(corners[0], corners[1], corners[2], MAZE_WALL_COLOR);
+    }
+}
+
+// HUD
+// ----------------------------------------------------------------------------------------
+// Icons are the 16px atlas sprites scaled to a tile, 5px apart, centered on their position
+static void soft_icon_row(Rectangle source, float startX, float y, int count) {
+    float size = (float)TILE_SIZE;
+    for (int i = 0; i < count; i++) {
+        SoftDrawSprite(source, (Rectangle){ startX + i * (size + 5), y, size, size }, (Vector2){ size / 2.0f, size / 2.0f }, WHITE);
+    }
+}
+
+void SoftDrawHudIcons(float livesX, float fruitsX, float y, int lives, int fruits) {
+    soft_icon_row(SPRITE_LIFE_ICON, livesX, y, lives);
+    soft_icon_row(SPRITE_FRUIT, fruitsX, y, fruits);
+}
@@ -0,0 +1,62 @@
+#include "sprite_atlas.h"
+#include <stdio.h>
+
+// Sprite Atlas
+// ----------------------------------------------------------------------------------------
+Image BakeSpriteAtlas(Image sheet) {
+    if (sheet.width != SPRITE_SHEET_WIDTH || sheet.height != SPRITE_SHEET_HEIGHT) {
+        printf("Sprite sheet is %dx%d, expected %dx%d\n", sheet.width, sheet.height, SPRITE_SHEET_WIDTH, SPRITE_SHEET_HEIGHT);
+        return (Image){ 0 };
+    }
+
+    Image atlas = ImageCopy(sheet);
+    ImageFormat(&atlas, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    // Replace black (RGB 0,0,0) with transparent (RGBA 0,0,0,0)
+    Color black = { 0, 0, 0, 255 };
+    Color transparent = { 0, 0, 0, 0 };
+    ImageColorReplace(&atlas, black, transparent);
+
+    // Make room below the sheet for the pre-rotated Pac-Man strip
+    ImageResizeCanvas(&atlas, SPRITE_ATLAS_WIDTH, SPRITE_ATLAS_HEIGHT, 0, 0, transparent);
+
+    // Clockwise quarter turns for each row, in Direction order: up, down, left, right
+    const int quarterTurns[ROTATED_PACMAN_ROWS] = { 3, 1, 2, 0 };
+
+    for (int row = 0; row < ROTATED_PACMAN_ROWS; row++) {
+        for (int frame = 0; frame < PACMAN_FRAME_COUNT; frame++) {
+            Rectangle source = { frame * PACMAN_FRAME_STRIDE, 0.0f, SPRITE_FRAME_SIZE, SPRITE_FRAME_SIZE };
+            Image sprite = ImageFromImage(atlas, source);
+            for (int turn = 0; turn < quarterTurns[row]; turn++) {
+                ImageRotateCW(&sprite);
+            }
+
+            Rectangle dest = { frame * PACMAN_FRAME_STRIDE, ROTATED_PACMAN_Y + row * PACMAN_FRAME_STRIDE,
+                               SPRITE_FRAME_SIZE, SPRITE_FRAME_SIZE };
+            ImageDraw(&atlas, sprite, (Rectangle){ 0, 0, SPRITE_FRAME_SIZE, SPRITE_FRAME_SIZE }, dest, WHITE);
+            UnloadImage(sprite);
+        }
+    }
+
+    // Premultiply last so the rotated copies are blended from straight alpha
+    ImageAlphaPremultiply(&atlas);
+
+    return atlas;
+}
+
+Texture2D LoadSpriteAtlas(void) {
+    Image atlas = LoadImage(SPRITE_ATLAS_PATH);
+
+    if (atlas.data == NULL || atlas.width != SPRITE_ATLAS_WIDTH || atlas.height != SPRITE_ATLAS_HEIGHT) {
+        // Not baked (or stale): do the pixel pass now
+        printf("Baked sprite atlas not found, building it from %s\n", SPRITE_SHEET_PATH);
+        UnloadImage(atlas);
+        Image sheet = LoadImage(SPRITE_SHEET_PATH);
+        atlas = BakeSpriteAtlas(sheet);
+        UnloadImage(sheet);
+    }
+
+    Texture2D texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+    return texture;
+}
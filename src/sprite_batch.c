@@ -0,0 +1,134 @@
+#include "sprite_batch.h"
+#include "sprite_palette.h"
+#include "rlgl.h"
+#include <math.h>
+
+// One queued quad, already transformed to screen space
+typedef struct {
+    Vector2 corners[4];     // Top-left, bottom-left, bottom-right, top-right
+    Vector2 uv[4];
+    Color tint;
+} SpriteQuad;
+
+static SpriteQuad queue[SPRITE_BATCH_CAPACITY];
+static int queueCount = 0;
+static Texture2D queueTexture = { 0 };
+static bool batchActive = false;
+
+static SpriteBatchStats frameStats = { 0 };     // Frame being drawn
+static SpriteBatchStats lastFrameStats = { 0 }; // Last finished frame
+
+// Sprite Batch
+// ----------------------------------------------------------------------------------------
+void SpriteBatchBegin(void) {
+    queueCount = 0;
+    queueTexture = (Texture2D){ 0 };
+    batchActive = true;
+}
+
+void SpriteBatchDraw(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    // Without the palette shader a palette tint would multiply the sprite away
+    if (IsSpritePaletteTint(tint) && !IsSpritePaletteReady()) {
+        tint = WHITE;
+    }
+    if (!batchActive) {
+        BeginSpritePalette();
+        DrawTexturePro(texture, source, dest, origin, rotation, tint);
+        EndSpritePalette();
+        return;
+    }
+
+    // A different texture or a full queue forces the queued sprites out first
+    if (queueCount > 0 && (texture.id != queueTexture.id || queueCount == SPRITE_BATCH_CAPACITY)) {
+        frameStats.batchBreaks ++;
+        SpriteBatchFlush();
+    }
+    queueTexture = texture;
+
+    // Flip the texture coordinates for negative source sizes, as DrawTexturePro does
+    bool flipX = false;
+    if (source.width < 0) { flipX = true; source.width *= -1; }
+    if (source.height < 0) source.y -= source.height;
+
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+    float u0 = (flipX ? source.x + source.width : source.x) / width;
+    float u1 = (flipX ? source.x : source.x + source.width) / width;
+    float v0 = source.y / height;
+    float v1 = (source.y + source.height) / height;
+
+    SpriteQuad *quad = &queue[queueCount ++];
+    quad->uv[0] = (Vector2){ u0, v0 };
+    quad->uv[1] = (Vector2){ u0, v1 };
+    quad->uv[2] = (Vector2){ u1, v1 };
+    quad->uv[3] = (Vector2){ u1, v0 };
+    quad->tint = tint;
+
+    if (rotation == 0.0f) {
+        float x = dest.x - origin.x;
+        float y = dest.y - origin.y;
+        quad->corners[0] = (Vector2){ x, y };
+        quad->corners[1] = (Vector2){ x, y + dest.height };
+        quad->corners[2] = (Vector2){ x + dest.width, y + dest.height };
+        quad->corners[3] = (Vector2){ x + dest.width, y };
+    } else {
+        float sinRotation = sinf(rotation * DEG2RAD);
+        float cosRotation = cosf(rotation * DEG2RAD);
+        float dx = -origin.x;
+        float dy = -origin.y;
+
+        quad->corners[0] = (Vector2){ dest.x + dx * cosRotation - dy * sinRotation,
+                                      dest.y + dx * sinRotation + dy * cosRotation };
+        quad->corners[1] = (Vector2){ dest.x + dx * cosRotation - (dy + dest.height) * sinRotation,
+                                      dest.y + dx * sinRotation + (dy + dest.height) * cosRotation };
+        quad->corners[2] = (Vector2){ dest.x + (dx + dest.width) * cosRotation - (dy + dest.height) * sinRotation,
+                                      dest.y + (dx + dest.width) * sinRotation + (dy + dest.height) * cosRotation };
+        quad->corners[3] = (Vector2){ dest.x + (dx + dest.width) * cosRotation - dy * sinRotation,
+                                      dest.y + (dx + dest.width) * sinRotation + dy * cosRotation };
+    }
+
+    frameStats.sprites ++;
+}
+
+void SpriteBatchFlush(void) {
+    if (queueCount == 0) {
+        return;
+    }
+
+    // Sprites come from the premultiplied-alpha atlas, and may pick a palette through their tint
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    BeginSpritePalette();
+    rlCheckRenderBatchLimit(queueCount * 4);
+    rlSetTexture(queueTexture.id);
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    for (int i = 0; i < queueCount; i++) {
+        const SpriteQuad *quad = &queue[i];
+        rlColor4ub(quad->tint.r, quad->tint.g, quad->tint.b, quad->tint.a);
+        for (int corner = 0; corner < 4; corner++) {
+            rlTexCoord2f(quad->uv[corner].x, quad->uv[corner].y);
+            rlVertex2f(quad->corners[corner].x, quad->corners[corner].y);
+        }
+    }
+    rlEnd();
+    rlSetTexture(0);
+    EndSpritePalette();
+    EndBlendMode();
+
+    frameStats.drawCalls ++;
+    queueCount = 0;
+}
+
+void SpriteBatchEnd(void) {
+    SpriteBatchFlush();
+    batchActive = false;
+}
+
+void SpriteBatchNewFrame(void) {
+    lastFrameStats = frameStats;
+    frameStats = (SpriteBatchStats){ 0 };
+}
+
+SpriteBatchStats GetSpriteBatchStats(void) {
+    return lastFrameStats;
+}
@@ -0,0 +1,140 @@
+#include "sprite_palette.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define PALETTE_PARAM_SCALE 4096.0f     // Parameter steps per second in a palette tint
+#define FRIGHTENED_FLASH_TIME 2.0f      // Frightened ghosts flash during their last 2 seconds
+#define FRIGHTENED_FLASH_PERIOD 0.4f    // White for 0.2s, blue for 0.2s
+
+// Colours the palettes swap (sprite sheet colours, see assets/sprites)
+static const Color frightenedBody = { 33, 33, 255, 255 };
+static const Color frightenedFace = { 255, 183, 174, 255 };
+static const Color flashBody = { 222, 222, 255, 255 };
+static const Color flashFace = { 255, 0, 0, 255 };
+
+// Shader source header for the OpenGL version raylib is built against
+#if defined(GRAPHICS_API_OPENGL_ES2) || defined(GRAPHICS_API_OPENGL_ES3)
+    #define PALETTE_SHADER_HEADER "#version 100\n" "precision mediump float;\n" \
+                                  "#define IN varying\n" "#define TEX texture2D\n" "#define finalColor gl_FragColor\n"
+#elif defined(GRAPHICS_API_OPENGL_21)
+    #define PALETTE_SHADER_HEADER "#version 120\n" \
+                                  "#define IN varying\n" "#define TEX texture2D\n" "#define finalColor gl_FragColor\n"
+#else
+    #define PALETTE_SHADER_HEADER "#version 330\n" \
+                                  "#define IN in\n" "#define TEX texture\n" "out vec4 finalColor;\n"
+#endif
+
+// Ordinary tints multiply as in raylib's default shader; a zero-alpha tint selects a palette in
+// its red channel and carries the palette's parameter in green and blue. Mirrors ApplySpritePalette.
+static const char *paletteFragmentShader = PALETTE_SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform float time;\n"
+    "bool near(vec3 a, vec3 b) { return all(lessThan(abs(a - b), vec3(0.02))); }\n"
+    "void main() {\n"
+    "    vec4 texel = TEX(texture0, fragTexCoord);\n"
+    "    if (fragColor.a > 0.0) {\n"
+    "        finalColor = texel * colDiffuse * fragColor;\n"
+    "        return;\n"
+    "    }\n"
+    "    float palette = floor(fragColor.r * 255.0 + 0.5);\n"
+    "    float seconds = (floor(fragColor.g * 255.0 + 0.5) * 256.0 + floor(fragColor.b * 255.0 + 0.5)) / 4096.0;\n"
+    "    if (palette == 1.0 && seconds <= 2.0 && mod(seconds, 0.4) > 0.2) {\n"
+    "        if (near(texel.rgb, vec3(0.129, 0.129, 1.0))) texel.rgb = vec3(0.871, 0.871, 1.0);\n"
+    "        else if (near(texel.rgb, vec3(1.0, 0.718, 0.682))) texel.rgb = vec3(1.0, 0.0, 0.0);\n"
+    "    } else if (palette == 2.0 && fract(time) >= 0.5 && near(texel.rgb, vec3(1.0, 0.631, 0.0))) {\n"
+    "        texel = vec4(0.0);\n"
+    "    }\n"
+    "    finalColor = texel * colDiffuse;\n"
+    "}\n";
+
+static Shader paletteShader = { 0 };
+static bool shaderLoaded = false;
+static int timeLoc = -1;
+static float paletteTime = 0.0f;
+
+static bool same_color(Color a, Color b) {
+    return abs(a.r - b.r) <= 5 && abs(a.g - b.g) <= 5 && abs(a.b - b.b) <= 5;
+}
+
+// Sprite Palette
+// ----------------------------------------------------------------------------------------
+void LoadSpritePalette(void) {
+    paletteShader = LoadShaderFromMemory(NULL, paletteFragmentShader);
+    shaderLoaded = paletteShader.id != 0 && paletteShader.id != rlGetShaderIdDefault();  // Falls back to the default shader on failure
+    if (!shaderLoaded) {
+        printf("Palette shader unavailable, power pellets and frightened ghosts will not blink\n");
+        return;
+    }
+    timeLoc = GetShaderLocation(paletteShader, "time");
+}
+
+void UnloadSpritePalette(void) {
+    if (shaderLoaded) {
+        UnloadShader(paletteShader);
+        shaderLoaded = false;
+    }
+}
+
+bool IsSpritePaletteReady(void) {
+    return shaderLoaded;
+}
+
+Color GetSpritePaletteTint(SpritePalette palette, float seconds) {
+    if (palette == SPRITE_PALETTE_NONE) {
+        return WHITE;
+    }
+    int param = (int)fminf(fmaxf(seconds, 0.0f) * PALETTE_PARAM_SCALE, 65535.0f);
+    return (Color){ (unsigned char)palette, (unsigned char)(param >> 8), (unsigned char)(param & 0xFF), 0 };
+}
+
+bool IsSpritePaletteTint(Color tint) {
+    return tint.a == 0 && tint.r != SPRITE_PALETTE_NONE;
+}
+
+void SetSpritePaletteTime(float time) {
+    paletteTime = time;
+}
+
+void BeginSpritePalette(void) {
+    if (!shaderLoaded) {
+        return;
+    }
+    SetShaderValue(paletteShader, timeLoc, &paletteTime, SHADER_UNIFORM_FLOAT);
+    BeginShaderMode(paletteShader);
+}
+
+void EndSpritePalette(void) {
+    if (shaderLoaded) {
+        EndShaderMode();
+    }
+}
+
+Color ApplySpritePalette(Color texel, Color tint) {
+    if (!IsSpritePaletteTint(tint)) {
+        return (Color){ (unsigned char)(texel.r * tint.r / 255), (unsigned char)(texel.g * tint.g / 255),
+                        (unsigned char)(texel.b * tint.b / 255), (unsigned char)(texel.a * tint.a / 255) };
+    }
+
+    float seconds = ((tint.g << 8) | tint.b) / PALETTE_PARAM_SCALE;
+    switch ((SpritePalette)tint.r) {
+        case SPRITE_PALETTE_FRIGHTENED:
+            if (seconds <= FRIGHTENED_FLASH_TIME && fmodf(seconds, FRIGHTENED_FLASH_PERIOD) > FRIGHTENED_FLASH_PERIOD / 2.0f) {
+                if (same_color(texel, frightenedBody)) return (Color){ flashBody.r, flashBody.g, flashBody.b, texel.a };
+                if (same_color(texel, frightenedFace)) return (Color){ flashFace.r, flashFace.g, flashFace.b, texel.a };
+            }
+            break;
+        case SPRITE_PALETTE_POWER_PELLETS:
+            if (paletteTime - floorf(paletteTime) >= 0.5f && same_color(texel, POWER_PELLET_COLOR)) {
+                return BLANK;
+            }
+            break;
+        default:
+            break;
+    }
+    return texel;
+}
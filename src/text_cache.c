@@ -0,0 +1,85 @@
+#include "text_cache.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    char text[TEXT_CACHE_MAX_LENGTH];
+    unsigned int fontId;
+    float fontSize;
+    float spacing;
+    Vector2 size;
+    bool used;
+} TextCacheEntry;
+
+static TextCacheEntry cache[TEXT_CACHE_SIZE];
+
+// FNV-1a over the text and the font settings
+static unsigned int hash_text(const char *text, unsigned int fontId, float fontSize, float spacing) {
+    unsigned int hash = 2166136261u;
+    for (const char *c = text; *c != '\0'; c++) {
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    }
+    unsigned int bits[3] = { fontId, 0, 0 };
+    memcpy(&bits[1], &fontSize, sizeof(float));
+    memcpy(&bits[2], &spacing, sizeof(float));
+    for (int i = 0; i < 3; i++) {
+        hash = (hash ^ bits[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Text Cache
+// ----------------------------------------------------------------------------------------
+Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing) {
+    if (strlen(text) >= TEXT_CACHE_MAX_LENGTH) {
+        return MeasureTextEx(font, text, fontSize, spacing);
+    }
+
+    unsigned int fontId = font.texture.id;
+    TextCacheEntry *entry = &cache[hash_text(text, fontId, fontSize, spacing) % TEXT_CACHE_SIZE];
+    if (entry->used && entry->fontId == fontId && entry->fontSize == fontSize &&
+        entry->spacing == spacing && strcmp(entry->text, text) == 0) {
+        return entry->size;
+    }
+
+    strcpy(entry->text, text);
+    entry->fontId = fontId;
+    entry->fontSize = fontSize;
+    entry->spacing = spacing;
+    entry->size = MeasureTextEx(font, text, fontSize, spacing);
+    entry->used = true;
+    return entry->size;
+}
+
+void ClearTextCache(void) {
+    memset(cache, 0, sizeof(cache));
+}
+
+const char *FormatTextLabel(TextLabel *label, const int keys[TEXT_LABEL_KEYS], const char *format, ...) {
+    if (label->formatted && memcmp(label->keys, keys, sizeof(label->keys)) == 0) {
+        return label->text;
+    }
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(label->text, sizeof(label->text), format, args);
+    va_end(args);
+
+    memcpy(label->keys, keys, sizeof(label->keys));
+    label->formatted = true;
+    label->measured = false;
+    return label->text;
+}
+
+Vector2 MeasureTextLabel(TextLabel *label, Font font, float fontSize, float spacing) {
+    if (!label->measured || label->fontId != font.texture.id ||
+        label->fontSize != fontSize || label->spacing != spacing) {
+        label->size = MeasureTextEx(font, label->text, fontSize, spacing);
+        label->fontId = font.texture.id;
+        label->fontSize = fontSize;
+        label->spacing = spacing;
+        label->measured = true;
+    }
+    return label->size;
+}
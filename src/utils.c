@@ -5,7 +5,15 @@ bool IsTileWalkable(int x, int y, bool canPassGate) {
     if (x < 0 || x >= MAZE_WIDTH || y < 0 || y >= MAZE_HEIGHT) {
         return false;
     }
-    return maze[y][x] != WALL && (maze[y][x] != GHOST_GATE || canPassGate);
+    TileType tile = get_tile(x, y);
+    return tile != WALL && (tile != GHOST_GATE || canPassGate);
+}
+
+// Movement always lands exactly on tile centres, so only float noise needs tolerating here
+bool IsAtTileCenter(float x, float y, int gridX, int gridY) {
+    float centerX = gridX * TILE_SIZE + TILE_SIZE / 2.0f;
+    float centerY = gridY * TILE_SIZE + TILE_SIZE / 2.0f;
+    return fabsf(x - centerX) < 0.001f && fabsf(y - centerY) < 0.001f;
 }
 
 // Calculates the Euclidean distance between two points in a 2D space
@@ -16,4 +24,94 @@ float CalculateDistance(float x1, float y1, float x2, float y2) {
 bool CheckCollision(float x1, float y1, float x2, float y2, float radius) {
     float dist = CalculateDistance(x1, y1, x2, y2);
     return dist < radius;
-}
\ No newline at end of file
+}
+
+// Finds the minimum distance between two entities over a tick by working in A's frame of reference:
+// the relative position moves linearly from (startA - startB) to (endA - endB).
+bool CheckSweptCollision(Vector2 startA, Vector2 endA, Vector2 startB, Vector2 endB, float radius) {
+    float relX = startA.x - startB.x;
+    float relY = startA.y - startB.y;
+    float velX = (endA.x - startA.x) - (endB.x - startB.x);
+    float velY = (endA.y - startA.y) - (endB.y - startB.y);
+
+    // Time of closest approach, clamped to the tick
+    float t = 0.0f;
+    float speedSq = velX * velX + velY * velY;
+    if (speedSq > 0.0f) {
+        t = -(relX * velX + relY * velY) / speedSq;
+        if (t < 0.0f) t = 0.0f;
+        if (t > 1.0f) t = 1.0f;
+    }
+
+    float closestX = relX + velX * t;
+    float closestY = relY + velY * t;
+    return closestX * closestX + closestY * closestY < radius * radius;
+}
+
+void BeginMotionPath(MotionPath *path, float x, float y, float time) {
+    if (time <= 0.0f) {
+        path->count = 0;
+    } else if (path->count == MOTION_PATH_POINTS) {
+        path->count --;     // Out of room: the new piece replaces the last point
+    }
+    int index = path->count ++;
+    path->points[index] = (Vector2){ x, y };
+    path->times[index] = time;
+    path->jumps[index] = index > 0;
+}
+
+// Once the path is full the last point is moved along instead, merging the final corners into one chord
+void AddMotionPoint(MotionPath *path, float x, float y, float time) {
+    int last = path->count - 1;
+    if (path->times[last] == time) {
+        return;
+    }
+    if (path->count == MOTION_PATH_POINTS && path->jumps[last]) {
+        return;             // Never merge across a jump
+    }
+    int index = (path->count < MOTION_PATH_POINTS) ? path->count ++ : last;
+    path->points[index] = (Vector2){ x, y };
+    path->times[index] = time;
+    path->jumps[index] = false;
+}
+
+// Where an entity was at the given fraction of the tick. At the moment of a jump it is still on the
+// near side for the stretch of time ending there, and already on the far side for the one starting there.
+static Vector2 motion_path_position(const MotionPath *path, float time, bool startingHere) {
+    for (int i = 1; i < path->count; i++) {
+        if (startingHere ? time < path->times[i] : time <= path->times[i]) {
+            Vector2 from = path->points[i - 1];
+            if (path->jumps[i]) {
+                return from;
+            }
+            Vector2 to = path->points[i];
+            float f = (time - path->times[i - 1]) / (path->times[i] - path->times[i - 1]);
+            return (Vector2){ from.x + (to.x - from.x) * f, from.y + (to.y - from.y) * f };
+        }
+    }
+    return path->points[path->count - 1];
+}
+
+// Splits the tick at every corner and jump of either path; in between, both move in straight lines
+bool CheckSweptPathCollision(const MotionPath *a, const MotionPath *b, float radius) {
+    float start = 0.0f;
+    int nextA = 1;
+    int nextB = 1;
+    while (true) {
+        while (nextA < a->count && a->times[nextA] <= start) nextA ++;
+        while (nextB < b->count && b->times[nextB] <= start) nextB ++;
+
+        float end = 1.0f;
+        if (nextA < a->count && a->times[nextA] < end) end = a->times[nextA];
+        if (nextB < b->count && b->times[nextB] < end) end = b->times[nextB];
+
+        if (CheckSweptCollision(motion_path_position(a, start, true), motion_path_position(a, end, false),
+                                motion_path_position(b, start, true), motion_path_position(b, end, false), radius)) {
+            return true;
+        }
+        if (end >= 1.0f) {
+            return false;
+        }
+        start = end;
+    }
+}
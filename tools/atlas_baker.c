@@ -0,0 +1,173 @@
+// Bakes the sprite atlas and its frame table.
+//
+// Run from the repository root (the premake build does this before compiling the game):
+//   atlas_baker
+// Reads  assets/sprites/pacman_general_sprites.png
+// Writes assets/sprites/pacman_atlas.png and include/sprite_frames.h
+
+#include "raylib.h"
+#include "game_logic.h"
+#include "sprite_atlas.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_HEADER_PATH "include/sprite_frames.h"
+
+// Frame Table Writer
+// ----------------------------------------------------------------------------------------
+// Rows of the [Direction] tables below are written in enum order: none, up, down, left, right
+static const char *directionNames[5] = { "DIR_NONE", "DIR_UP", "DIR_DOWN", "DIR_LEFT", "DIR_RIGHT" };
+
+static void append(char *buffer, size_t size, const char *format, ...) {
+    size_t used = strlen(buffer);
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer + used, size - used, format, args);
+    va_end(args);
+}
+
+static void append_rect(char *buffer, size_t size, float x, float y) {
+    append(buffer, size, "{ %.0f, %.0f, %d, %d }", x, y, SPRITE_FRAME_SIZE, SPRITE_FRAME_SIZE);
+}
+
+static void build_frame_header(char *out, size_t size) {
+    out[0] = '\0';
+    append(out, size,
+        "// Generated by tools/atlas_baker.c - do not edit.\n"
+        "// Source rectangles in the baked sprite atlas (" SPRITE_ATLAS_PATH ").\n"
+        "#ifndef SPRITE_FRAMES_H\n"
+        "#define SPRITE_FRAMES_H\n"
+        "\n"
+        "#include \"raylib.h\"\n"
+        "\n");
+
+    // Pac-Man: pre-rotated strip, DIR_NONE faces right like the unrotated sprite
+    const int pacmanRow[5] = { 3, 0, 1, 2, 3 };
+    append(out, size, "// Pac-Man mouth frames, pre-rotated to face each way: [Direction][frame]\n");
+    append(out, size, "static const Rectangle SPRITE_PACMAN[5][%d] = {\n", PACMAN_FRAME_COUNT);
+    for (int dir = 0; dir < 5; dir++) {
+        append(out, size, "    { ");
+        for (int frame = 0; frame < PACMAN_FRAME_COUNT; frame++) {
+            append_rect(out, size, frame * PACMAN_FRAME_STRIDE, ROTATED_PACMAN_Y + pacmanRow[dir] * PACMAN_FRAME_STRIDE);
+            append(out, size, frame < PACMAN_FRAME_COUNT - 1 ? ", " : " ");
+        }
+        append(out, size, "},    // %s\n", directionNames[dir]);
+    }
+    append(out, size, "};\n\n");
+
+    // Pac-Man death animation
+    const int deathFrames = PACMAN_DEATH_FRAMES;
+    append(out, size, "// Pac-Man death animation frames\n");
+    append(out, size, "static const Rectangle SPRITE_PACMAN_DEATH[%d] = {\n", deathFrames);
+    for (int frame = 0; frame < deathFrames; frame++) {
+        append(out, size, "    ");
+        append_rect(out, size, 36.0f + frame * 16.0f, 0.0f);
+        append(out, size, ",\n");
+    }
+    append(out, size, "};\n\n");
+
+    // Ghosts: one row per ghost, two frames per facing
+    const float ghostRowY[4] = { 64.0f, 80.0f, 96.0f, 112.0f };            // Blinky, Pinky, Inky, Clyde
+    const float ghostFacingX[5] = { 4.0f, 68.0f, 100.0f, 36.0f, 4.0f };    // DIR_NONE faces right
+    append(out, size, "// Ghost body frames: [ghost][Direction][frame]\n");
+    append(out, size, "static const Rectangle SPRITE_GHOST[4][5][2] = {\n");
+    for (int ghost = 0; ghost < 4; ghost++) {
+        append(out, size, "    {\n");
+        for (int dir = 0; dir < 5; dir++) {
+            append(out, size, "        { ");
+            append_rect(out, size, ghostFacingX[dir], ghostRowY[ghost]);
+            append(out, size, ", ");
+            append_rect(out, size, ghostFacingX[dir] + 16.0f, ghostRowY[ghost]);
+            append(out, size, " },    // %s\n", directionNames[dir]);
+        }
+        append(out, size, "    },\n");
+    }
+    append(out, size, "};\n\n");
+
+    // Returning ghost eyes
+    const float eyesFacingX[5] = { 132.0f, 164.0f, 180.0f, 148.0f, 132.0f };
+    append(out, size, "// Returning ghost eyes: [Direction][frame]\n");
+    append(out, size, "static const Rectangle SPRITE_GHOST_EYES[5][2] = {\n");
+    for (int dir = 0; dir < 5; dir++) {
+        append(out, size, "    { ");
+        append_rect(out, size, eyesFacingX[dir], 80.0f);
+        append(out, size, ", ");
+        append_rect(out, size, eyesFacingX[dir] + 16.0f, 80.0f);
+        append(out, size, " },    // %s\n", directionNames[dir]);
+    }
+    append(out, size, "};\n\n");
+
+    append(out, size, "// Frightened ghost: [0] blue, [1] white (blinking)\n");
+    append(out, size, "static const Rectangle SPRITE_GHOST_FRIGHTENED[2] = { ");
+    append_rect(out, size, 132.0f, 64.0f);
+    append(out, size, ", ");
+    append_rect(out, size, 164.0f, 64.0f);
+    append(out, size, " };\n\n");
+
+    append(out, size, "// Ghost score popups: 200, 400, 800, 1600\n");
+    append(out, size, "static const Rectangle SPRITE_GHOST_SCORE[4] = { ");
+    for (int i = 0; i < 4; i++) {
+        append_rect(out, size, 4.0f + i * 16.0f, 128.0f);
+        append(out, size, i < 3 ? ", " : " ");
+    }
+    append(out, size, "};\n\n");
+
+    append(out, size, "// Bonus fruit\n");
+    append(out, size, "static const Rectangle SPRITE_FRUIT = ");
+    append_rect(out, size, 35.0f, 48.0f);
+    append(out, size, ";\n\n");
+
+    append(out, size, "// HUD life icon\n");
+    append(out, size, "static const Rectangle SPRITE_LIFE_ICON = ");
+    append_rect(out, size, 18.0f, 0.0f);
+    append(out, size, ";\n\n");
+
+    append(out, size, "#endif // SPRITE_FRAMES_H\n");
+}
+
+// Writes the header only if its contents changed, so rebuilding does not touch every dependent file
+static bool write_if_changed(const char *path, const char *contents) {
+    char *existing = LoadFileText(path);
+    bool same = existing != NULL && strcmp(existing, contents) == 0;
+    UnloadFileText(existing);
+    if (same) {
+        return true;
+    }
+    return SaveFileText(path, (char *)contents);
+}
+
+int main(void) {
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image sheet = LoadImage(SPRITE_SHEET_PATH);
+    if (sheet.data == NULL) {
+        fprintf(stderr, "atlas_baker: cannot load %s (run from the repository root)\n", SPRITE_SHEET_PATH);
+        return EXIT_FAILURE;
+    }
+
+    Image atlas = BakeSpriteAtlas(sheet);
+    UnloadImage(sheet);
+    if (atlas.data == NULL) {
+        fprintf(stderr, "atlas_baker: could not bake the atlas\n");
+        return EXIT_FAILURE;
+    }
+
+    bool ok = ExportImage(atlas, SPRITE_ATLAS_PATH);
+    UnloadImage(atlas);
+    if (!ok) {
+        fprintf(stderr, "atlas_baker: cannot write %s\n", SPRITE_ATLAS_PATH);
+        return EXIT_FAILURE;
+    }
+
+    static char header[16384];
+    build_frame_header(header, sizeof(header));
+    if (!write_if_changed(FRAME_HEADER_PATH, header)) {
+        fprintf(stderr, "atlas_baker: cannot write %s\n", FRAME_HEADER_PATH);
+        return EXIT_FAILURE;
+    }
+
+    printf("atlas_baker: wrote %s and %s\n", SPRITE_ATLAS_PATH, FRAME_HEADER_PATH);
+    return EXIT_SUCCESS;
+}